@@ -0,0 +1,330 @@
+#include "AsyncLog.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+#if TARGET_OS_ANDROID
+#include <android/log.h>
+#endif
+
+namespace {
+    const size_t slotCount = 512;                   // must be a power of two
+    const size_t errorSlots = 32;                   // the last free slots only take errors
+    const size_t messageLength = 512;               // fits the JSON of the import statistics
+    const size_t recentCount = 256;                 // must be a power of two
+    const unsigned int burstPerWindow = 5;
+    const std::chrono::milliseconds rateWindow(2000);
+    const std::chrono::milliseconds flushInterval(50);
+
+    typedef std::chrono::steady_clock Clock;
+
+    void writeToPlatform(AsyncLog::Level level, const char *text) {
+#if TARGET_OS_ANDROID
+        int priority = level == AsyncLog::Level::Error ? ANDROID_LOG_ERROR : level == AsyncLog::Level::Warning ? ANDROID_LOG_WARN : ANDROID_LOG_DEBUG;
+        __android_log_write(priority, "SandboxApp", text);
+#else
+        (void)level;
+        fputs(text, stdout);
+#endif
+    }
+
+    uint64_t hashMessage(AsyncLog::Level level, const char *text) {
+        uint64_t hash = 14695981039346656037ull ^ static_cast<uint64_t>(level);
+        for (; *text != '\0'; ++text) {
+            hash ^= static_cast<unsigned char>(*text);
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    // A slot is free for the producer whose position equals its sequence, and holds a message once the sequence is one past it
+    struct Slot {
+        std::atomic<size_t>     sequence;
+        AsyncLog::Level         level;
+        char                    text[messageLength];
+    };
+
+    // A message seen lately by the producers. Messages whose hashes share an entry take it over from each other, which
+    // only lets their repeats through. The window number and the count of messages in it share one atomic
+    struct RecentMessage {
+        std::atomic<uint64_t>   hash;
+        std::atomic<uint64_t>   windowAndCount;
+        std::atomic<uint32_t>   suppressed;
+    };
+
+    // The text of a message which went through the ring, kept by the background thread to report its suppressed repeats
+    struct RateEntry {
+        Clock::time_point       windowStart;
+        uint64_t                hash;
+        unsigned int            suppressed;
+        AsyncLog::Level         level;
+        std::string             text;
+    };
+
+    class Logger {
+    public:
+        Logger()
+        : minimumLevel(static_cast<int>(AsyncLog::Level::Debug)), tail(0), head(0), dropped(0), running(true), stopping(false), wake(false) {
+            for (size_t i = 0; i < slotCount; ++i)
+                slots[i].sequence.store(i, std::memory_order_relaxed);
+            for (size_t i = 0; i < recentCount; ++i) {
+                recent[i].hash.store(0, std::memory_order_relaxed);
+                recent[i].windowAndCount.store(0, std::memory_order_relaxed);
+                recent[i].suppressed.store(0, std::memory_order_relaxed);
+            }
+            worker = std::thread(&Logger::run, this);
+        }
+
+        ~Logger() {
+            stop();
+        }
+
+        bool accepts(AsyncLog::Level level) const {
+            return static_cast<int>(level) >= minimumLevel.load(std::memory_order_relaxed);
+        }
+
+        void write(AsyncLog::Level level, const char *format, va_list args) {
+            char text[messageLength];
+            vsnprintf(text, sizeof(text), format, args);
+
+            if (!running.load(std::memory_order_acquire)) {
+                writeToPlatform(level, text);
+                return;
+            }
+
+            // Repeats past the burst never reach the ring, so that a storm of one message cannot crowd out the others
+            if (!admit(hashMessage(level, text)))
+                return;
+
+            size_t position = tail.load(std::memory_order_relaxed);
+            Slot *slot;
+            for (;;) {
+                slot = &slots[position & (slotCount - 1)];
+                size_t sequence = slot->sequence.load(std::memory_order_acquire);
+                intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+                bool reserved = level != AsyncLog::Level::Error && position - head.load(std::memory_order_acquire) >= slotCount - errorSlots;
+                if (difference == 0 && !reserved) {
+                    if (tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                        break;
+                }
+                else if (difference <= 0) {
+                    // The ring is full, the writer is never held up, but an error is written right away rather than lost
+                    if (level == AsyncLog::Level::Error)
+                        writeToPlatform(level, text);
+                    else
+                        dropped.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+                else
+                    position = tail.load(std::memory_order_relaxed);
+            }
+
+            slot->level = level;
+            memcpy(slot->text, text, strlen(text) + 1);
+            slot->sequence.store(position + 1, std::memory_order_release);
+
+            // Errors are written right away, anything else waits for the next flush interval
+            if (level == AsyncLog::Level::Error) {
+                std::lock_guard<std::mutex> lock(mutex);
+                wake = true;
+                wakeCondition.notify_one();
+            }
+        }
+
+        void flush() {
+            size_t target = tail.load(std::memory_order_acquire);
+            std::unique_lock<std::mutex> lock(mutex);
+            wake = true;
+            wakeCondition.notify_one();
+            drainedCondition.wait(lock, [&]() { return head.load(std::memory_order_acquire) >= target || !running.load(std::memory_order_acquire); });
+        }
+
+        void stop() {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (stopping)
+                    return;
+                stopping = true;
+                wakeCondition.notify_one();
+            }
+            if (worker.joinable())
+                worker.join();
+
+            // Picks up what writers slipped in while the thread was stopping
+            drain();
+            endWindows(true);
+        }
+
+        std::atomic<int>        minimumLevel;
+
+    private:
+        // Counts the message in the window it is written in, and tells whether it is still within the burst
+        bool admit(uint64_t hash) {
+            RecentMessage & entry = recent[hash & (recentCount - 1)];
+            uint64_t window = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now().time_since_epoch()).count() / rateWindow.count());
+
+            if (entry.hash.load(std::memory_order_acquire) != hash) {
+                // The repeats counted for the previous message are reported as dropped, its text is not known here
+                size_t lost = entry.suppressed.exchange(0, std::memory_order_relaxed);
+                if (lost > 0)
+                    dropped.fetch_add(lost, std::memory_order_relaxed);
+                entry.hash.store(hash, std::memory_order_release);
+                entry.windowAndCount.store(window << 32 | 1, std::memory_order_relaxed);
+                return true;
+            }
+
+            uint64_t current = entry.windowAndCount.load(std::memory_order_relaxed);
+            uint64_t next;
+            do {
+                next = (current >> 32) == (window & 0xffffffffu) ? current + 1 : window << 32 | 1;
+            } while (!entry.windowAndCount.compare_exchange_weak(current, next, std::memory_order_relaxed));
+
+            if ((next & 0xffffffffu) <= burstPerWindow)
+                return true;
+            entry.suppressed.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        void run() {
+            for (;;) {
+                bool last;
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    wakeCondition.wait_for(lock, flushInterval, [&]() { return wake || stopping; });
+                    wake = false;
+                    last = stopping;
+                }
+
+                // Writers still racing with the stop are written synchronously from now on
+                if (last)
+                    running.store(false, std::memory_order_release);
+
+                drain();
+                endWindows(last);
+
+                std::lock_guard<std::mutex> lock(mutex);
+                drainedCondition.notify_all();
+                if (last)
+                    return;
+            }
+        }
+
+        void drain() {
+            size_t position = head.load(std::memory_order_relaxed);
+            for (;;) {
+                Slot & slot = slots[position & (slotCount - 1)];
+                if (slot.sequence.load(std::memory_order_acquire) != position + 1)
+                    break;
+
+                emit(slot.level, slot.text);
+                slot.sequence.store(position + slotCount, std::memory_order_release);
+                head.store(++position, std::memory_order_release);
+            }
+
+            size_t lost = dropped.exchange(0, std::memory_order_relaxed);
+            if (lost > 0) {
+                char text[messageLength];
+                snprintf(text, sizeof(text), "AsyncLog: %zu messages dropped, the log was full\n", lost);
+                writeToPlatform(AsyncLog::Level::Warning, text);
+            }
+        }
+
+        void emit(AsyncLog::Level level, const char *text) {
+            Clock::time_point now = Clock::now();
+            uint64_t hash = hashMessage(level, text);
+            auto found = rates.find(hash);
+            if (found == rates.end()) {
+                RateEntry & entry = rates[hash];
+                entry.windowStart = now;
+                entry.hash = hash;
+                entry.suppressed = 0;
+                entry.level = level;
+                entry.text = text;
+            }
+            else if (now - found->second.windowStart >= rateWindow) {
+                reportSuppressed(found->second);
+                found->second.windowStart = now;
+            }
+
+            writeToPlatform(level, text);
+        }
+
+        // Counts of suppressed repeats are written once their window is over, and quiet messages are forgotten
+        void endWindows(bool all) {
+            Clock::time_point now = Clock::now();
+            for (auto it = rates.begin(); it != rates.end();) {
+                if (all || now - it->second.windowStart >= rateWindow) {
+                    reportSuppressed(it->second);
+                    it = rates.erase(it);
+                }
+                else
+                    ++it;
+            }
+        }
+
+        void reportSuppressed(RateEntry & entry) {
+            RecentMessage & recentEntry = recent[entry.hash & (recentCount - 1)];
+            if (recentEntry.hash.load(std::memory_order_acquire) == entry.hash)
+                entry.suppressed += recentEntry.suppressed.exchange(0, std::memory_order_relaxed);
+            if (entry.suppressed == 0)
+                return;
+
+            char text[messageLength];
+            snprintf(text, sizeof(text), "AsyncLog: repeated %u more times: %s", entry.suppressed, entry.text.c_str());
+            writeToPlatform(entry.level, text);
+            entry.suppressed = 0;
+        }
+
+        Slot                                    slots[slotCount];
+        std::atomic<size_t>                     tail;
+        std::atomic<size_t>                     head;
+        std::atomic<size_t>                     dropped;
+        std::atomic<bool>                       running;
+        RecentMessage                           recent[recentCount];
+
+        std::mutex                              mutex;
+        std::condition_variable                 wakeCondition;
+        std::condition_variable                 drainedCondition;
+        bool                                    stopping;
+        bool                                    wake;
+        std::thread                             worker;
+
+        std::unordered_map<uint64_t, RateEntry> rates;          // background thread only
+    };
+
+    Logger & logger() {
+        static Logger instance;
+        return instance;
+    }
+}
+
+void AsyncLog::setLevel(Level minimum) {
+    logger().minimumLevel.store(static_cast<int>(minimum), std::memory_order_relaxed);
+}
+
+void AsyncLog::write(Level level, const char *format, ...) {
+    Logger & log = logger();
+    if (!log.accepts(level))
+        return;
+
+    va_list args;
+    va_start(args, format);
+    log.write(level, format, args);
+    va_end(args);
+}
+
+void AsyncLog::flush() {
+    logger().flush();
+}
+
+void AsyncLog::shutdown() {
+    logger().stop();
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+// AsyncLog is what dprintf, wprintf and eprintf write to. Messages are formatted on the calling thread straight into
+// a fixed ring of slots, which producers claim without locking, and a background thread hands them to the platform log.
+// A full ring drops the message rather than blocking, and the number of dropped messages is logged once there is room.
+// The last slots of the ring are kept for errors, and an error which still finds it full is written synchronously.
+//
+// Identical messages are rate limited before they take a slot: past a small burst in a window, repeats are only
+// counted in a small table of recent messages, and the background thread writes a single line with the count when the
+// window ends. A model importing with thousands of identical warnings costs the import thread a formatted message per
+// warning, and the ring and logcat a handful of lines.
+
+namespace AsyncLog
+{
+    enum class Level
+    {
+        Debug,
+        Warning,
+        Error,
+    };
+
+    // Messages below the minimum level are discarded before they are formatted
+    void        setLevel(Level minimum);
+
+    void        write(Level level, const char *format, ...)
+#if defined(__GNUC__) || defined(__clang__)
+        __attribute__((format(printf, 2, 3)))
+#endif
+        ;
+
+    // Blocks until every message written so far has been handed to the platform log
+    void        flush();
+
+    // Flushes and stops the background thread. Messages written afterwards are logged synchronously
+    void        shutdown();
+}
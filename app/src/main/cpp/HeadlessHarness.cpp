@@ -0,0 +1,248 @@
+#include "HeadlessHarness.h"
+#include "dprintf.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+namespace {
+    double millisecondsSince(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    bool fileExists(std::string const & fileName) {
+        FILE *file = std::fopen(fileName.c_str(), "rb");
+        if (file == nullptr)
+            return false;
+        std::fclose(file);
+        return true;
+    }
+
+    bool capture(HPS::View const & view, std::string const & fileName, unsigned int width, unsigned int height, unsigned int maxTileSize) {
+        HPS::OffscreenCapture::SetMaxTileSize(maxTileSize);
+        bool written = false;
+        if (HPS::OffscreenCapture::Start(view, fileName.c_str(), width, height, HPS::Image::Format::Png,
+                [&written](bool success, HPS::UTF8 const &) { written = success; }, HPS::Window::Driver::OpenGL2Mesa))
+            HPS::OffscreenCapture::Shutdown();
+        return written;
+    }
+
+    const char *outcomeName(HeadlessHarness::Outcome outcome) {
+        switch (outcome) {
+            case HeadlessHarness::Outcome::Passed:
+                return "passed";
+            case HeadlessHarness::Outcome::Recorded:
+                return "recorded";
+            case HeadlessHarness::Outcome::Mismatched:
+                return "mismatched";
+            default:
+                return "failed";
+        }
+    }
+}
+
+HeadlessHarness::HeadlessHarness(unsigned int width, unsigned int height)
+: width(width), height(height), referenceDirectory("."), outputDirectory("."), channelTolerance(8), pixelTolerance(0.001f), timedFrames(10) { }
+
+void HeadlessHarness::setTolerance(int channelTolerance, float pixelTolerance) {
+    this->channelTolerance = channelTolerance;
+    this->pixelTolerance = pixelTolerance;
+}
+
+HeadlessHarness::Result HeadlessHarness::run(Case const & test) {
+    Result result;
+    result.name = test.name;
+    result.outcome = Outcome::Failed;
+    result.loadMilliseconds = 0;
+    result.firstFrameMilliseconds = 0;
+    result.frameMilliseconds = 0;
+    result.mismatchedPixels = 1.0f;
+
+    // A surface per case, so that nothing a dataset leaves behind reaches the next one
+    UserMobileSurface surface;
+    if (!surface.bindOffscreen(width, height)) {
+        eprintf("%s: could not bind an offscreen surface\n", test.name.c_str());
+        return result;
+    }
+
+    HPS::Canvas canvas = surface.GetCanvas();
+
+    auto start = std::chrono::steady_clock::now();
+    bool loaded = surface.loadFile(test.fileName.c_str());
+    result.loadMilliseconds = millisecondsSince(start);
+
+    if (loaded) {
+        if (!test.camera.Empty())
+            canvas.GetFrontView().GetSegmentKey().SetCamera(test.camera);
+
+        start = std::chrono::steady_clock::now();
+        canvas.UpdateWithNotifier(HPS::Window::UpdateType::Complete).Wait();
+        result.firstFrameMilliseconds = millisecondsSince(start);
+
+        // Exhaustive updates redraw everything, as a camera change would
+        if (timedFrames > 0) {
+            start = std::chrono::steady_clock::now();
+            for (int frame = 0; frame < timedFrames; ++frame)
+                canvas.UpdateWithNotifier(HPS::Window::UpdateType::Exhaustive).Wait();
+            result.frameMilliseconds = millisecondsSince(start) / timedFrames;
+        }
+
+        HPS::ImageKit frame;
+        if (surface.readFrame(frame)) {
+            std::string referenceFile = referenceDirectory + "/" + test.name + ".png";
+            std::string outputFile = outputDirectory + "/" + test.name + ".png";
+
+            try {
+                if (!fileExists(referenceFile)) {
+                    HPS::Image::File::Export(referenceFile.c_str(), HPS::ImageKit(frame, HPS::Image::Format::Png));
+                    result.mismatchedPixels = 0;
+                    result.outcome = Outcome::Recorded;
+                }
+                else {
+                    HPS::Image::ImportOptionsKit importOpts;
+                    importOpts.SetFormat(HPS::Image::Format::Png);
+                    HPS::ImageKit reference = HPS::Image::File::Import(referenceFile.c_str(), importOpts);
+
+                    if (compare(frame, reference, result.mismatchedPixels) && result.mismatchedPixels <= pixelTolerance)
+                        result.outcome = Outcome::Passed;
+                    else {
+                        // Keep the frame next to the reference it failed against
+                        HPS::Image::File::Export(outputFile.c_str(), HPS::ImageKit(frame, HPS::Image::Format::Png));
+                        result.outcome = Outcome::Mismatched;
+                    }
+                }
+            }
+            catch (HPS::IOException const & e) {
+                eprintf("%s: %s\n", test.name.c_str(), e.what());
+                result.outcome = Outcome::Failed;
+            }
+        }
+    }
+    else
+        eprintf("%s: could not load %s\n", test.name.c_str(), test.fileName.c_str());
+
+    surface.release(0);
+    return result;
+}
+
+HeadlessHarness::Result HeadlessHarness::runTiledCapture(Case const & test, unsigned int tileSize) {
+    Result result;
+    result.name = test.name + "_tiled";
+    result.outcome = Outcome::Failed;
+    result.loadMilliseconds = 0;
+    result.firstFrameMilliseconds = 0;
+    result.frameMilliseconds = 0;
+    result.mismatchedPixels = 1.0f;
+
+    UserMobileSurface surface;
+    if (!surface.bindOffscreen(width, height)) {
+        eprintf("%s: could not bind an offscreen surface\n", result.name.c_str());
+        return result;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    bool loaded = surface.loadFile(test.fileName.c_str());
+    result.loadMilliseconds = millisecondsSince(start);
+
+    if (loaded) {
+        HPS::View view = surface.GetCanvas().GetFrontView();
+        if (!test.camera.Empty())
+            view.GetSegmentKey().SetCamera(test.camera);
+
+        // Parallax between the tiles only shows in perspective
+        view.GetSegmentKey().GetCameraControl().SetProjection(HPS::Camera::Projection::Perspective);
+        surface.GetCanvas().UpdateWithNotifier(HPS::Window::UpdateType::Complete).Wait();
+
+        std::string wholeFile = outputDirectory + "/" + result.name + "_whole.png";
+        std::string tiledFile = outputDirectory + "/" + result.name + ".png";
+
+        start = std::chrono::steady_clock::now();
+        bool captured = capture(view, wholeFile, width, height, (std::max)(width, height));
+        result.firstFrameMilliseconds = millisecondsSince(start);
+
+        start = std::chrono::steady_clock::now();
+        captured = captured && capture(view, tiledFile, width, height, tileSize);
+        result.frameMilliseconds = millisecondsSince(start);
+
+        // Back to the default tile size
+        HPS::OffscreenCapture::SetMaxTileSize(2048);
+
+        if (captured) {
+            try {
+                HPS::Image::ImportOptionsKit importOpts;
+                importOpts.SetFormat(HPS::Image::Format::Png);
+                HPS::ImageKit whole = HPS::Image::File::Import(wholeFile.c_str(), importOpts);
+                HPS::ImageKit tiled = HPS::Image::File::Import(tiledFile.c_str(), importOpts);
+
+                if (compare(tiled, whole, result.mismatchedPixels) && result.mismatchedPixels <= pixelTolerance)
+                    result.outcome = Outcome::Passed;
+                else
+                    result.outcome = Outcome::Mismatched;
+            }
+            catch (HPS::IOException const & e) {
+                eprintf("%s: %s\n", result.name.c_str(), e.what());
+                result.outcome = Outcome::Failed;
+            }
+        }
+        else
+            eprintf("%s: could not capture %s\n", result.name.c_str(), test.fileName.c_str());
+    }
+    else
+        eprintf("%s: could not load %s\n", result.name.c_str(), test.fileName.c_str());
+
+    surface.release(0);
+    return result;
+}
+
+std::vector<HeadlessHarness::Result> HeadlessHarness::run(std::vector<Case> const & tests) {
+    std::vector<Result> results;
+    results.reserve(tests.size());
+    for (auto const & test : tests)
+        results.push_back(run(test));
+    return results;
+}
+
+bool HeadlessHarness::report(std::vector<Result> const & results) {
+    bool passed = true;
+    for (auto const & result : results) {
+        dprintf("%-24s %-10s load %8.1f ms  first frame %8.1f ms  frame %8.2f ms  mismatched %6.3f%%\n",
+            result.name.c_str(), outcomeName(result.outcome), result.loadMilliseconds, result.firstFrameMilliseconds,
+            result.frameMilliseconds, result.mismatchedPixels * 100.0f);
+
+        if (result.outcome == Outcome::Mismatched || result.outcome == Outcome::Failed)
+            passed = false;
+    }
+    return passed;
+}
+
+bool HeadlessHarness::compare(HPS::ImageKit const & frame, HPS::ImageKit const & reference, float & mismatchedPixels) const {
+    unsigned int frameWidth, frameHeight, referenceWidth, referenceHeight;
+    if (!frame.ShowSize(frameWidth, frameHeight) || !reference.ShowSize(referenceWidth, referenceHeight))
+        return false;
+    if (frameWidth != referenceWidth || frameHeight != referenceHeight)
+        return false;
+
+    // Both images are compared as RGBA, whatever the reference was decoded into
+    HPS::ByteArray framePixels, referencePixels;
+    if (!HPS::ImageKit(frame, HPS::Image::Format::RGBA).ShowData(framePixels) ||
+        !HPS::ImageKit(reference, HPS::Image::Format::RGBA).ShowData(referencePixels))
+        return false;
+
+    size_t pixelCount = static_cast<size_t>(frameWidth) * frameHeight;
+    if (framePixels.size() < pixelCount * 4 || referencePixels.size() < pixelCount * 4)
+        return false;
+
+    size_t mismatched = 0;
+    for (size_t pixel = 0; pixel < pixelCount; ++pixel) {
+        for (size_t channel = 0; channel < 4; ++channel) {
+            int difference = std::abs(static_cast<int>(framePixels[pixel * 4 + channel]) - static_cast<int>(referencePixels[pixel * 4 + channel]));
+            if (difference > channelTolerance) {
+                ++mismatched;
+                break;
+            }
+        }
+    }
+
+    mismatchedPixels = pixelCount > 0 ? static_cast<float>(mismatched) / pixelCount : 0;
+    return true;
+}
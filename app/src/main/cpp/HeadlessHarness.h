@@ -0,0 +1,74 @@
+#pragma once
+
+#include "UserMobileSurface.h"
+#include <string>
+#include <vector>
+
+// HeadlessHarness renders datasets through UserMobileSurface::loadFile on a surface bound with
+// MobileSurface::bindOffscreen(), so that the app can be checked on a host without a device or GPU.
+// Every case is drawn from a fixed camera, timed, and compared against a reference image.
+//
+// References are png files named after the case in the reference directory. When a reference is
+// missing, the frame is written there instead, and the case is reported as recorded.
+
+class HeadlessHarness
+{
+public:
+    struct Case
+    {
+        std::string         name;
+        std::string         fileName;
+        HPS::CameraKit      camera;     // empty to keep the camera fitted by loadFile
+    };
+
+    enum class Outcome
+    {
+        Passed,
+        Recorded,
+        Mismatched,
+        Failed,
+    };
+
+    struct Result
+    {
+        std::string         name;
+        Outcome             outcome;
+        double              loadMilliseconds;
+        double              firstFrameMilliseconds;
+        double              frameMilliseconds;      // average of the redraws after the first frame
+        float               mismatchedPixels;       // fraction of the pixels beyond the channel tolerance
+    };
+
+    HeadlessHarness(unsigned int width, unsigned int height);
+
+    void                    setReferenceDirectory(const char *referenceDir) { referenceDirectory = referenceDir; }
+    void                    setOutputDirectory(const char *outputDir) { outputDirectory = outputDir; }
+
+    // Pixels whose channels differ by more than channelTolerance are mismatched. A case fails when
+    // more than pixelTolerance of the pixels are mismatched, which leaves room for rasterizer noise.
+    void                    setTolerance(int channelTolerance, float pixelTolerance);
+
+    // Number of redraws timed after the first frame
+    void                    setTimedFrames(int frames) { timedFrames = frames; }
+
+    Result                  run(Case const & test);
+    std::vector<Result>     run(std::vector<Case> const & tests);
+
+    // Captures the case through HPS::OffscreenCapture with a perspective camera, once in one piece and once in tiles of
+    // tileSize, and compares the two images. Tiles which are not seen from the eye point of the view leave seams between them.
+    Result                  runTiledCapture(Case const & test, unsigned int tileSize);
+
+    // Writes a line per result, and returns true if no case mismatched or failed
+    static bool             report(std::vector<Result> const & results);
+
+private:
+    bool                    compare(HPS::ImageKit const & frame, HPS::ImageKit const & reference, float & mismatchedPixels) const;
+
+    unsigned int            width;
+    unsigned int            height;
+    std::string             referenceDirectory;
+    std::string             outputDirectory;
+    int                     channelTolerance;
+    float                   pixelTolerance;
+    int                     timedFrames;
+};
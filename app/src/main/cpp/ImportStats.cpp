@@ -0,0 +1,166 @@
+#include "ImportStats.h"
+#include "sprk_ops.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <unordered_map>
+
+namespace {
+    typedef std::unordered_map<HPS::Key, size_t, HPS::KeyHasher> DepthMap;
+
+    // A segment is walked again only when reached through a deeper chain of includes, so that shared
+    // segments are counted once, and the walk stays linear for heavily instanced models
+    void collectSegment(HPS::SegmentKey const & segment, size_t segmentDepth, size_t includeDepth, DepthMap & visited, ImportStats & stats) {
+        auto it = visited.find(segment);
+        bool firstVisit = it == visited.end();
+        if (!firstVisit && it->second >= includeDepth)
+            return;
+        visited[segment] = includeDepth;
+
+        stats.maxSegmentDepth = (std::max)(stats.maxSegmentDepth, segmentDepth);
+        stats.maxIncludeDepth = (std::max)(stats.maxIncludeDepth, includeDepth);
+
+        HPS::SearchResults results;
+        if (firstVisit) {
+            ++stats.segmentCount;
+
+            if (segment.Find(HPS::Search::Type::Shell, HPS::Search::Space::SegmentOnly, results) > 0) {
+                auto shells = results.GetIterator();
+                while (shells.IsValid()) {
+                    HPS::ShellKey shell(shells.GetItem());
+                    ++stats.shellCount;
+                    stats.vertexCount += shell.GetPointCount();
+                    stats.faceCount += shell.GetFaceCount();
+                    shells.Next();
+                }
+            }
+        }
+
+        HPS::SegmentKeyArray children;
+        segment.ShowSubsegments(children);
+        for (auto const & child : children) {
+            // Level of detail and memory budget proxies are built in the background while the stats are collected
+            if (HPS::InteractionLOD::IsProxySegment(child) || HPS::MemoryBudget::IsProxySegment(child))
+                continue;
+            collectSegment(child, segmentDepth + 1, includeDepth, visited, stats);
+        }
+
+        if (segment.Find(HPS::Search::Type::Include, HPS::Search::Space::SegmentOnly, results) > 0) {
+            auto includes = results.GetIterator();
+            while (includes.IsValid()) {
+                if (firstVisit)
+                    ++stats.includeCount;
+                HPS::IncludeKey include(includes.GetItem());
+                collectSegment(include.GetTarget(), segmentDepth + 1, includeDepth + 1, visited, stats);
+                includes.Next();
+            }
+        }
+    }
+
+    void writeString(std::ostringstream & json, std::string const & value) {
+        json << '"';
+        for (char c : value) {
+            if (c == '"' || c == '\\')
+                json << '\\' << c;
+            else if (static_cast<unsigned char>(c) < 0x20) {
+                char escaped[8];
+                snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                json << escaped;
+            }
+            else
+                json << c;
+        }
+        json << '"';
+    }
+
+    void writeMilliseconds(std::ostringstream & json, double value) {
+        if (value < 0)
+            json << "null";
+        else {
+            char formatted[32];
+            snprintf(formatted, sizeof(formatted), "%.1f", value);
+            json << formatted;
+        }
+    }
+}
+
+ImportStats::ImportStats()
+: success(false), segmentCount(0), includeCount(0), maxIncludeDepth(0), maxSegmentDepth(0), shellCount(0), vertexCount(0), faceCount(0),
+  imageCount(0), textureBytes(0), parseMilliseconds(-1), insertMilliseconds(-1), optimizeMilliseconds(-1),
+  tessellationMilliseconds(-1), totalMilliseconds(-1), peakMemoryBytes(0), databaseBytes(0) { }
+
+void ImportStats::collect(HPS::Model const & model) {
+    DepthMap visited;
+    collectSegment(model.GetSegmentKey(), 0, 0, visited, *this);
+
+    // Images are counted at their stored size, compressed ones are expanded when they are drawn
+    HPS::ImageDefinitionArray images;
+    if (model.GetPortfolioKey().ShowAllImageDefinitions(images)) {
+        imageCount = images.size();
+        for (auto const & image : images) {
+            HPS::ImageKit kit;
+            HPS::ByteArray data;
+            image.Show(kit);
+            if (kit.ShowData(data))
+                textureBytes += data.size();
+        }
+    }
+
+    size_t allocated, used;
+    HPS::Database::ShowMemoryUsage(allocated, used);
+    databaseBytes = allocated;
+}
+
+std::string ImportStats::toJson() const {
+    std::ostringstream json;
+    json << "{\"file\":";
+    writeString(json, fileName);
+    json << ",\"format\":";
+    writeString(json, format);
+    json << ",\"success\":" << (success ? "true" : "false")
+        << ",\"segments\":" << segmentCount
+        << ",\"includes\":" << includeCount
+        << ",\"include_depth\":" << maxIncludeDepth
+        << ",\"segment_depth\":" << maxSegmentDepth
+        << ",\"shells\":" << shellCount
+        << ",\"vertices\":" << vertexCount
+        << ",\"faces\":" << faceCount
+        << ",\"images\":" << imageCount
+        << ",\"texture_bytes\":" << textureBytes;
+    json << ",\"parse_ms\":";
+    writeMilliseconds(json, parseMilliseconds);
+    json << ",\"insert_ms\":";
+    writeMilliseconds(json, insertMilliseconds);
+    json << ",\"optimize_ms\":";
+    writeMilliseconds(json, optimizeMilliseconds);
+    json << ",\"tessellation_ms\":";
+    writeMilliseconds(json, tessellationMilliseconds);
+    json << ",\"total_ms\":";
+    writeMilliseconds(json, totalMilliseconds);
+    json << ",\"peak_memory_bytes\":" << peakMemoryBytes
+        << ",\"database_bytes\":" << databaseBytes << "}";
+    return json.str();
+}
+
+// Writing 5 to clear_refs resets VmHWM on Linux 4.0 and later, which covers the Android versions the app runs on
+void ImportStats::resetPeakMemory() {
+    std::ofstream clearRefs("/proc/self/clear_refs");
+    if (clearRefs)
+        clearRefs << "5";
+}
+
+size_t ImportStats::readPeakMemory() {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, 6, "VmHWM:") == 0) {
+            std::istringstream fields(line.substr(6));
+            size_t kilobytes = 0;
+            fields >> kilobytes;
+            return kilobytes * 1024;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "hps.h"
+#include "sprk.h"
+#include <string>
+
+// ImportStats describes what the last UserMobileSurface::loadFile brought in and what it cost, to find the models
+// which need preprocessing and the scene graphs which are pathological. Times which a reader doesn't report
+// separately are negative, and written as null in the JSON.
+
+struct ImportStats
+{
+    ImportStats();
+
+    std::string     fileName;
+    std::string     format;
+    bool            success;
+
+    // Segments and shells reached through several includes are counted once
+    size_t          segmentCount;
+    size_t          includeCount;
+    size_t          maxIncludeDepth;
+    size_t          maxSegmentDepth;
+    size_t          shellCount;
+    size_t          vertexCount;
+    size_t          faceCount;
+    size_t          imageCount;
+    size_t          textureBytes;
+
+    // Stream, STL and OBJ readers insert into the database as they parse, only Exchange reports the two apart.
+    // Tessellation is measured as the first complete update, where curved geometry is tessellated and display lists are built.
+    double          parseMilliseconds;
+    double          insertMilliseconds;
+    double          optimizeMilliseconds;
+    double          tessellationMilliseconds;
+    double          totalMilliseconds;
+
+    size_t          peakMemoryBytes;        // peak resident size of the process during the load, 0 where it can't be read
+    size_t          databaseBytes;          // memory allocated by HPS once the load is done
+
+    // Counts the scene graph and the images of the model
+    void            collect(HPS::Model const & model);
+
+    std::string     toJson() const;
+
+    // The peak resident size is reset before a load, so that it only covers that load
+    static void     resetPeakMemory();
+    static size_t   readPeakMemory();
+};
@@ -0,0 +1,246 @@
+#include "InputTrace.h"
+#include "dprintf.h"
+#include <algorithm>
+
+namespace {
+    const char traceMagic[4] = { 'H', 'T', 'R', 'C' };
+    const uint16_t traceVersion = 1;
+
+    void writeByte(std::ostream & out, uint8_t value) {
+        out.put(static_cast<char>(value));
+    }
+
+    void writeUInt16(std::ostream & out, uint16_t value) {
+        writeByte(out, static_cast<uint8_t>(value & 0xff));
+        writeByte(out, static_cast<uint8_t>(value >> 8));
+    }
+
+    // Screen coordinates always fit, clamping only guards against bogus input
+    void writeInt16(std::ostream & out, int value) {
+        int16_t clamped = static_cast<int16_t>((std::max)(-32768, (std::min)(32767, value)));
+        writeUInt16(out, static_cast<uint16_t>(clamped));
+    }
+
+    // Most deltas and touch ids take one or two bytes this way
+    void writeVarint(std::ostream & out, uint64_t value) {
+        while (value >= 0x80) {
+            writeByte(out, static_cast<uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        writeByte(out, static_cast<uint8_t>(value));
+    }
+
+    bool readByte(std::istream & in, uint8_t & value) {
+        char c;
+        if (!in.get(c))
+            return false;
+        value = static_cast<uint8_t>(c);
+        return true;
+    }
+
+    bool readUInt16(std::istream & in, uint16_t & value) {
+        uint8_t low, high;
+        if (!readByte(in, low) || !readByte(in, high))
+            return false;
+        value = static_cast<uint16_t>(low | (high << 8));
+        return true;
+    }
+
+    bool readInt16(std::istream & in, int & value) {
+        uint16_t raw;
+        if (!readUInt16(in, raw))
+            return false;
+        value = static_cast<int16_t>(raw);
+        return true;
+    }
+
+    bool readVarint(std::istream & in, uint64_t & value) {
+        value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            uint8_t byte;
+            if (!readByte(in, byte))
+                return false;
+            value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0)
+                return true;
+        }
+        return false;
+    }
+
+    bool readString(std::istream & in, size_t length, std::string & value) {
+        value.resize(length);
+        return length == 0 || in.read(&value[0], length);
+    }
+}
+
+InputTrace::InputTrace()
+: recording(false) { }
+
+InputTrace::~InputTrace() {
+    stopRecording();
+}
+
+bool InputTrace::startRecording(const char *fileName, unsigned int surfaceWidth, unsigned int surfaceHeight) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (recording)
+        return false;
+
+    file.open(fileName, std::ios::binary | std::ios::trunc);
+    if (!file)
+        return false;
+
+    file.write(traceMagic, sizeof(traceMagic));
+    writeUInt16(file, traceVersion);
+    writeUInt16(file, static_cast<uint16_t>(surfaceWidth));
+    writeUInt16(file, static_cast<uint16_t>(surfaceHeight));
+
+    lastRecordTime = std::chrono::steady_clock::now();
+    recording = true;
+    return true;
+}
+
+bool InputTrace::stopRecording() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!recording)
+        return false;
+
+    recording = false;
+    file.close();
+    return !file.fail();
+}
+
+void InputTrace::beginRecord(RecordType type) {
+    auto now = std::chrono::steady_clock::now();
+    uint64_t delta = std::chrono::duration_cast<std::chrono::microseconds>(now - lastRecordTime).count();
+    lastRecordTime = now;
+
+    writeByte(file, static_cast<uint8_t>(type));
+    writeVarint(file, delta);
+}
+
+void InputTrace::recordTouches(RecordType type, int numTouches, int xPosArray[], int yPosArray[], HPS::TouchID idArray[], size_t tapCount) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!recording)
+        return;
+
+    int count = (std::min)(numTouches, 255);
+    beginRecord(type);
+    writeByte(file, static_cast<uint8_t>((std::min)(tapCount, static_cast<size_t>(255))));
+    writeByte(file, static_cast<uint8_t>(count));
+    for (int i = 0; i < count; i++) {
+        writeInt16(file, xPosArray[i]);
+        writeInt16(file, yPosArray[i]);
+        writeVarint(file, static_cast<uint64_t>(idArray[i]));
+    }
+}
+
+void InputTrace::recordTap(RecordType type, int x, int y, HPS::TouchID id) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!recording)
+        return;
+
+    beginRecord(type);
+    writeInt16(file, x);
+    writeInt16(file, y);
+    writeVarint(file, static_cast<uint64_t>(id));
+}
+
+void InputTrace::recordAction(const char *name, const char *argument) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!recording)
+        return;
+
+    std::string nameStr(name);
+    std::string argumentStr(argument);
+    nameStr.resize((std::min)(nameStr.size(), static_cast<size_t>(255)));
+    argumentStr.resize((std::min)(argumentStr.size(), static_cast<size_t>(65535)));
+
+    beginRecord(RecordType::SurfaceAction);
+    writeByte(file, static_cast<uint8_t>(nameStr.size()));
+    file.write(nameStr.data(), nameStr.size());
+    writeUInt16(file, static_cast<uint16_t>(argumentStr.size()));
+    file.write(argumentStr.data(), argumentStr.size());
+}
+
+bool InputTrace::load(const char *fileName, std::vector<Record> & records, unsigned int & surfaceWidth, unsigned int & surfaceHeight) {
+    std::ifstream in(fileName, std::ios::binary);
+    if (!in)
+        return false;
+
+    char magic[sizeof(traceMagic)];
+    uint16_t version, width, height;
+    if (!in.read(magic, sizeof(magic)) || !std::equal(magic, magic + sizeof(magic), traceMagic) ||
+        !readUInt16(in, version) || version != traceVersion || !readUInt16(in, width) || !readUInt16(in, height)) {
+        dprintf("InputTrace: %s is not a trace\n", fileName);
+        return false;
+    }
+    surfaceWidth = width;
+    surfaceHeight = height;
+
+    records.clear();
+    uint64_t time = 0;
+    uint8_t type;
+    while (readByte(in, type)) {
+        Record record;
+        record.type = static_cast<RecordType>(type);
+        record.tapCount = 1;
+
+        uint64_t delta;
+        if (!readVarint(in, delta)) {
+            dprintf("InputTrace: %s is truncated after %zu records\n", fileName, records.size());
+            break;
+        }
+        time += delta;
+        record.time = time;
+
+        bool valid = true;
+        switch (record.type) {
+            case RecordType::TouchDown:
+            case RecordType::TouchMove:
+            case RecordType::TouchUp:
+            case RecordType::TouchesCancel: {
+                uint8_t tapCount, count;
+                valid = readByte(in, tapCount) && readByte(in, count);
+                record.tapCount = tapCount;
+                for (uint8_t i = 0; valid && i < count; i++) {
+                    int x, y;
+                    uint64_t id;
+                    valid = readInt16(in, x) && readInt16(in, y) && readVarint(in, id);
+                    record.x.push_back(x);
+                    record.y.push_back(y);
+                    record.ids.push_back(static_cast<HPS::TouchID>(id));
+                }
+                break;
+            }
+            case RecordType::SingleTap:
+            case RecordType::DoubleTap: {
+                int x, y;
+                uint64_t id;
+                valid = readInt16(in, x) && readInt16(in, y) && readVarint(in, id);
+                record.x.push_back(x);
+                record.y.push_back(y);
+                record.ids.push_back(static_cast<HPS::TouchID>(id));
+                break;
+            }
+            case RecordType::SurfaceAction: {
+                uint8_t nameLength;
+                uint16_t argumentLength;
+                valid = readByte(in, nameLength) && readString(in, nameLength, record.action) &&
+                    readUInt16(in, argumentLength) && readString(in, argumentLength, record.argument);
+                break;
+            }
+            default:
+                valid = false;
+                break;
+        }
+
+        // A trace cut short by the process being killed is still worth replaying up to the damaged record
+        if (!valid) {
+            dprintf("InputTrace: %s is truncated after %zu records\n", fileName, records.size());
+            break;
+        }
+        records.push_back(record);
+    }
+
+    return true;
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "hps.h"
+#include <cstdint>
+#include <chrono>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// InputTrace records the input a MobileSurface receives, touches, taps and surface actions, with the time
+// they arrived, to a compact binary file. MobileSurface::replayTrace() plays such a file back, so that
+// interaction reported as slow on a device can be reproduced and timed again after a change.
+//
+// File layout, all integers little-endian:
+//   header   "HTRC", uint16 version, uint16 surface width, uint16 surface height
+//   record   uint8 type, varint microseconds since the previous record, then by type:
+//            touches     uint8 tap count, uint8 touch count, per touch: int16 x, int16 y, varint id
+//            tap         int16 x, int16 y, varint id
+//            action      uint8 name length, name, uint16 argument length, argument
+
+class InputTrace
+{
+public:
+    enum class RecordType : uint8_t
+    {
+        TouchDown = 1,
+        TouchMove,
+        TouchUp,
+        TouchesCancel,
+        SingleTap,
+        DoubleTap,
+        SurfaceAction,
+    };
+
+    struct Record
+    {
+        RecordType                  type;
+        uint64_t                    time;       // microseconds since the start of the trace
+        size_t                      tapCount;
+        std::vector<int>            x;
+        std::vector<int>            y;
+        std::vector<HPS::TouchID>   ids;
+        std::string                 action;
+        std::string                 argument;
+    };
+
+    InputTrace();
+    ~InputTrace();
+
+    bool                    startRecording(const char *fileName, unsigned int surfaceWidth, unsigned int surfaceHeight);
+    bool                    stopRecording();
+    bool                    isRecording() const { return recording; }
+
+    void                    recordTouches(RecordType type, int numTouches, int xPosArray[], int yPosArray[], HPS::TouchID idArray[], size_t tapCount);
+    void                    recordTap(RecordType type, int x, int y, HPS::TouchID id);
+    void                    recordAction(const char *name, const char *argument);
+
+    static bool             load(const char *fileName, std::vector<Record> & records, unsigned int & surfaceWidth, unsigned int & surfaceHeight);
+
+private:
+    void                    beginRecord(RecordType type);
+
+    std::mutex                              mutex;
+    bool                                    recording;
+    std::ofstream                           file;
+    std::chrono::steady_clock::time_point   lastRecordTime;
+};
+
+// Timings of a replay. Frame times are measured from the injection of an event to the end of the frame drawn for it.
+struct InputTraceReplayStats
+{
+    size_t                  events;
+    double                  totalMilliseconds;
+    double                  meanFrameMilliseconds;
+    double                  medianFrameMilliseconds;
+    double                  p95FrameMilliseconds;
+    double                  maxFrameMilliseconds;
+    double                  maxLagMilliseconds;     // how far behind the recorded times a real-time replay fell
+};
@@ -208,3 +208,31 @@ void ShowPerformanceTestResult(float fps)
 	return;
 }
 
+void imageExported(bool success, const char *fileName)
+{
+	JNIEnv *env = nullptr;
+	int status = g_javaVM->GetEnv((void **)&env, JNI_VERSION_1_6);
+	if (status == JNI_EDETACHED) {
+		int new_status = g_javaVM->AttachCurrentThread(&env, nullptr);
+		if( new_status != JNI_OK) {
+			return;
+		}
+	}
+
+	jmethodID callback = env->GetMethodID(classz, "ImageExported", "(ZLjava/lang/String;)V");
+	if (callback == nullptr) {
+		env->ExceptionClear();
+		if (status == JNI_EDETACHED) {
+			g_javaVM->DetachCurrentThread();
+		}
+		return;
+	}
+
+	jstring jfileName = env->NewStringUTF(fileName);
+	env->CallVoidMethod(classObject, callback, (jboolean)success, jfileName);
+	env->DeleteLocalRef(jfileName);
+	if (status == JNI_EDETACHED) {
+		g_javaVM->DetachCurrentThread();
+	}
+	return;
+}
@@ -23,6 +23,62 @@ static jboolean loadFileS(JNIEnv *env, jclass cobj, jlong ptr, jstring fileName)
 }
 
 
+static jint getImportStatsSBI(JNIEnv *env, jclass cobj, jlong ptr, jobject json, jint capacity)
+{
+	JNIHelpers::StringBuffer sbjson(env, json);
+	jint ret =((UserMobileSurface*)ptr)->getImportStats(sbjson.str(), capacity);
+	return ret;
+}
+
+
+static jboolean saveSessionS(JNIEnv *env, jclass cobj, jlong ptr, jstring sessionDir)
+{
+	JNIHelpers::String csessionDir(env, sessionDir);
+	jboolean ret =((UserMobileSurface*)ptr)->saveSession(csessionDir.str());
+	return ret;
+}
+
+
+static jboolean restoreSessionS(JNIEnv *env, jclass cobj, jlong ptr, jstring sessionDir)
+{
+	JNIHelpers::String csessionDir(env, sessionDir);
+	jboolean ret =((UserMobileSurface*)ptr)->restoreSession(csessionDir.str());
+	return ret;
+}
+
+
+static jboolean exportImageSII(JNIEnv *env, jclass cobj, jlong ptr, jstring fileName, jint width, jint height)
+{
+	JNIHelpers::String cfileName(env, fileName);
+	jboolean ret =((UserMobileSurface*)ptr)->exportImage(cfileName.str(), width, height);
+	return ret;
+}
+
+
+static jboolean startTraceS(JNIEnv *env, jclass cobj, jlong ptr, jstring fileName)
+{
+	JNIHelpers::String cfileName(env, fileName);
+	jboolean ret =((UserMobileSurface*)ptr)->startTrace(cfileName.str());
+	return ret;
+}
+
+
+static jboolean stopTraceV(JNIEnv *env, jclass cobj, jlong ptr)
+{
+	
+	jboolean ret =((UserMobileSurface*)ptr)->stopTrace();
+	return ret;
+}
+
+
+static jboolean playTraceSZ(JNIEnv *env, jclass cobj, jlong ptr, jstring fileName, jboolean realTime)
+{
+	JNIHelpers::String cfileName(env, fileName);
+	jboolean ret =((UserMobileSurface*)ptr)->playTrace(cfileName.str(), realTime);
+	return ret;
+}
+
+
 static void setOperatorOrbitV(JNIEnv *env, jclass cobj, jlong ptr)
 {
 	
@@ -98,6 +154,13 @@ bool registerAndroidUserMobileSurfaceViewNatives(JNIEnv *env)
 
 	JNINativeMethod	methods[] = {
 		{"loadFileS", "(JLjava/lang/String;)Z", (void*)loadFileS},
+		{"getImportStatsSBI", "(JLjava/lang/StringBuffer;I)I", (void*)getImportStatsSBI},
+		{"saveSessionS", "(JLjava/lang/String;)Z", (void*)saveSessionS},
+		{"restoreSessionS", "(JLjava/lang/String;)Z", (void*)restoreSessionS},
+		{"exportImageSII", "(JLjava/lang/String;II)Z", (void*)exportImageSII},
+		{"startTraceS", "(JLjava/lang/String;)Z", (void*)startTraceS},
+		{"stopTraceV", "(J)Z", (void*)stopTraceV},
+		{"playTraceSZ", "(JLjava/lang/String;Z)Z", (void*)playTraceSZ},
 		{"setOperatorOrbitV", "(J)V", (void*)setOperatorOrbitV},
 		{"onModeSimpleShadowZ", "(JZ)V", (void*)onModeSimpleShadowZ},
 		{"onModeSmoothV", "(J)V", (void*)onModeSmoothV},
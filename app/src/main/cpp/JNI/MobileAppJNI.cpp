@@ -47,6 +47,22 @@ static void setMaterialsDirectoryS(JNIEnv *env, jclass cobj, jstring materialsDi
 }
 
 
+static void setCacheDirectoryS(JNIEnv *env, jclass cobj, jstring cacheDir)
+{
+	JNIHelpers::String ccacheDir(env, cacheDir);
+	MobileApp::inst().setCacheDirectory(ccacheDir.str());
+	
+}
+
+
+static void trimMemoryI(JNIEnv *env, jclass cobj, jint level)
+{
+	
+	MobileApp::inst().trimMemory(level);
+	
+}
+
+
 
 bool registerMobileAppNatives(JNIEnv *env)
 {
@@ -61,6 +77,8 @@ bool registerMobileAppNatives(JNIEnv *env)
 		{"setLibraryDirectoryS", "(Ljava/lang/String;)V", (void*)setLibraryDirectoryS},
 		{"setFontDirectoryS", "(Ljava/lang/String;)V", (void*)setFontDirectoryS},
 		{"setMaterialsDirectoryS", "(Ljava/lang/String;)V", (void*)setMaterialsDirectoryS},
+		{"setCacheDirectoryS", "(Ljava/lang/String;)V", (void*)setCacheDirectoryS},
+		{"trimMemoryI", "(I)V", (void*)trimMemoryI},
 	};
 	const size_t	count = sizeof(methods) / sizeof(methods[0]);
 
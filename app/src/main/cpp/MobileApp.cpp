@@ -1,6 +1,7 @@
 
 #include "MobileApp.h"
 #include "dprintf.h"
+#include "sprk_ops.h"
 
 #include "hoops_license.h"
 
@@ -19,7 +20,16 @@ MobileApp::MobileApp()
 
 void MobileApp::shutdown()
 {
+    // Stop background indexing and decimation before the database goes away
+    HPS::PickingIndex::Shutdown();
+    HPS::InteractionLOD::Shutdown();
+    HPS::MemoryBudget::Shutdown();
+    HPS::OffscreenCapture::Shutdown();
+    HPS::SceneOptimizer::Shutdown();
     delete _world;
+
+    // Messages logged while shutting down would otherwise be lost with the process
+    AsyncLog::flush();
 }
 
 void MobileApp::setFontDirectory(const char* fontDir)
@@ -36,3 +46,58 @@ void MobileApp::setMaterialsDirectory(const char* materialsDir)
 {
 	_world->SetMaterialLibraryDirectory(materialsDir);
 }
+
+void MobileApp::setCacheDirectory(const char *cacheDir)
+{
+	// Shells unloaded to stay within the memory budget are written here
+	HPS::MemoryBudget::SetSpillDirectory(cacheDir);
+}
+
+void MobileApp::trimMemory(int level)
+{
+    // Levels from android.content.ComponentCallbacks2. The running levels are sent while the app is in the foreground,
+    // UI_HIDDEN once its UI is no longer visible, and the higher ones while it sits in the background list
+    const int TRIM_MEMORY_RUNNING_MODERATE = 5;
+    const int TRIM_MEMORY_RUNNING_LOW = 10;
+    const int TRIM_MEMORY_RUNNING_CRITICAL = 15;
+    const int TRIM_MEMORY_UI_HIDDEN = 20;
+    const int TRIM_MEMORY_BACKGROUND = 40;
+    const int TRIM_MEMORY_MODERATE = 60;
+
+    const bool foreground = level < TRIM_MEMORY_UI_HIDDEN;
+    const bool background = level >= TRIM_MEMORY_BACKGROUND;
+
+    // Caches are released from the cheapest to rebuild to the most expensive
+    size_t selections = 0, boundings = 0, pickingBytes = 0, proxySegments = 0, geometryBytes = 0;
+    bool captureCancelled = false;
+
+    // Selections are redone on the next tap
+    if (level >= TRIM_MEMORY_RUNNING_MODERATE)
+        selections = HPS::SelectionCache::InvalidateAll();
+
+    // Boundings are recomputed on the next fit or zoom, hidden or not
+    if (level >= TRIM_MEMORY_RUNNING_LOW)
+        boundings = HPS::BoundingCache::InvalidateAll();
+
+    // A screenshot holds the whole image and an offscreen window until it is written, it can be taken again
+    if ((foreground && level >= TRIM_MEMORY_RUNNING_CRITICAL) || background)
+        captureCancelled = HPS::OffscreenCapture::Cancel();
+
+    // Picking falls back to regular selection until the index is built again by the next pick. A hidden UI comes back
+    // as it was left, so the index is kept until the app is actually in the background
+    if ((foreground && level >= TRIM_MEMORY_RUNNING_CRITICAL) || background) {
+        pickingBytes = HPS::PickingIndex::GetMemoryUsage();
+        HPS::PickingIndex::InvalidateAll();
+    }
+
+    // Navigation draws at full detail until the proxies are generated again, on the first interaction after coming back
+    if (background)
+        proxySegments = HPS::InteractionLOD::ReleaseAll();
+
+    // Geometry outside of the view is written to the cache directory in the background, and read back once the camera looks at it
+    if (level >= TRIM_MEMORY_MODERATE)
+        geometryBytes = HPS::MemoryBudget::UnloadHidden();
+
+    dprintf("trimMemory(%d): released %zu selections, %zu boundings, %zu KB of picking index, %zu proxy segments, %s, unloading %zu KB of geometry\n",
+            level, selections, boundings, pickingBytes / 1024, proxySegments, captureCancelled ? "cancelled the capture" : "no capture", geometryBytes / 1024);
+}
@@ -68,6 +68,8 @@ public:
 	APP_ACTION void		setLibraryDirectory(const char *libraryDir);
 	APP_ACTION void		setFontDirectory(const char *fontDir);
 	APP_ACTION void		setMaterialsDirectory(const char *materialsDir);
+	APP_ACTION void		setCacheDirectory(const char *cacheDir);
+	APP_ACTION void		trimMemory(int level); // level is one of the ComponentCallbacks2.TRIM_MEMORY_* values
 
 private:
 	MobileApp();
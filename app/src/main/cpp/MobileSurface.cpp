@@ -2,6 +2,9 @@
 #include "MobileApp.h"
 #include "MobileSurface.h"
 #include "dprintf.h"
+#include <algorithm>
+#include <chrono>
+#include <thread>
 
 // g_android_platform_data is initialized in Android platforms
 HPS::PlatformData g_android_platform_data;
@@ -37,25 +40,68 @@ bool MobileSurface::bind(void *window)
         HPS::ApplicationWindowKey awk(_canvas.GetWindowKey());
         awk.GetWindowOptionsControl().SetWindowHandle(reinterpret_cast<HPS::WindowHandle>(window));
 	}
-    
-	touchesCancel();
 
 	_valid = true;
+
+	// Touches tracked before the surface went away will never be released. This needs a valid surface to reach the operators.
+	touchesCancel();
+
+	// Single redraw, which also picks up the new window size after a rotation
     _canvas.Update();
 
 	return true;
 }
 
+bool MobileSurface::bindOffscreen(unsigned int width, unsigned int height)
+{
+	// Ensure app is created
+	MobileApp::inst();
+
+	if (_canvas.Type() != HPS::Type::None || width == 0 || height == 0)
+		return false;
 
-void MobileSurface::release(int flags)
+	// Mesa renders in software, anti-aliasing is left off so that frames don't depend on the sample pattern
+	HPS::OffScreenWindowOptionsKit		windowOpts;
+	windowOpts.SetDriver(HPS::Window::Driver::OpenGL2Mesa);
+	windowOpts.SetAntiAliasCapable(false);
+
+	HPS::OffScreenWindowKey window = HPS::Database::CreateOffScreenWindow(width, height, windowOpts);
+	_canvas = HPS::Factory::CreateCanvas(window);
+
+	_valid = true;
+	_canvas.UpdateWithNotifier(HPS::Window::UpdateType::Complete).Wait();
+
+	return true;
+}
+
+bool MobileSurface::readFrame(HPS::ImageKit & image) const
 {
-	// Perform blocking update to flush any current or pending updates, then signal that the surface is invalid.
-	HPS::UpdateNotifier notifier = _canvas.UpdateWithNotifier(HPS::Window::UpdateType::Complete);
-	notifier.Wait();
+	if (_canvas.Type() == HPS::Type::None)
+		return false;
+
+	HPS::WindowKey window = _canvas.GetWindowKey();
+	if (window.Type() != HPS::Type::OffScreenWindowKey)
+		return false;
+
+	return HPS::OffScreenWindowKey(window).GetWindowOptionsControl().ShowImage(HPS::Image::Format::RGBA, image);
+}
 
-	// Don't destroy canvas if we're only rotating the screen.
-	if ((flags & SCREEN_ROTATING) == 0)
+void MobileSurface::release(int flags)
+{
+	if (flags & SCREEN_ROTATING)
+	{
+		// The frame being drawn is for the old size and bind redraws at the new one, so interrupt it rather than finishing it.
+		// Waiting is still needed to make sure the driver is done with the old window handle.
+		// Don't destroy canvas if we're only rotating the screen, the window keeps its display lists and static trees.
+		HPS::UpdateNotifier notifier = _canvas.UpdateWithNotifier(HPS::Window::UpdateType::Refresh);
+		notifier.Cancel().Wait();
+	}
+	else
 	{
+		// Perform blocking update to flush any current or pending updates, then signal that the surface is invalid.
+		HPS::UpdateNotifier notifier = _canvas.UpdateWithNotifier(HPS::Window::UpdateType::Complete);
+		notifier.Wait();
+
 	    _canvas.Delete();
 	    HPS::Database::Synchronize();
 	}
@@ -72,41 +118,155 @@ void MobileSurface::refresh()
         _canvas.Update(HPS::Window::UpdateType::Refresh);
 }
 
+bool MobileSurface::startRecordingTrace(const char *fileName)
+{
+	unsigned int width = 0, height = 0;
+	if (_canvas.Type() != HPS::Type::None)
+		_canvas.GetWindowKey().GetWindowInfoControl().ShowWindowPixels(width, height);
+
+	return _trace.startRecording(fileName, width, height);
+}
+
+bool MobileSurface::stopRecordingTrace()
+{
+	return _trace.stopRecording();
+}
+
+bool MobileSurface::replayTrace(const char *fileName, bool realTime, InputTraceReplayStats & stats)
+{
+	stats = InputTraceReplayStats();
+
+	// Replaying into the trace being recorded would never end
+	if (!isValid() || _trace.isRecording())
+		return false;
+
+	std::vector<InputTrace::Record> records;
+	unsigned int recordedWidth, recordedHeight;
+	if (!InputTrace::load(fileName, records, recordedWidth, recordedHeight))
+		return false;
+
+	// Touches are in pixels, on another size of surface they land elsewhere on the model
+	unsigned int width, height;
+	if (_canvas.GetWindowKey().GetWindowInfoControl().ShowWindowPixels(width, height) && (width != recordedWidth || height != recordedHeight))
+		dprintf("replayTrace: recorded on a %ux%u surface, replaying on %ux%u\n", recordedWidth, recordedHeight, width, height);
+
+	std::vector<double> frameTimes;
+	frameTimes.reserve(records.size());
+
+	auto start = std::chrono::steady_clock::now();
+	for (auto & record : records)
+	{
+		if (realTime)
+		{
+			auto due = start + std::chrono::microseconds(record.time);
+			auto now = std::chrono::steady_clock::now();
+			if (now < due)
+				std::this_thread::sleep_until(due);
+			else
+				stats.maxLagMilliseconds = (std::max)(stats.maxLagMilliseconds, std::chrono::duration<double, std::milli>(now - due).count());
+		}
+
+		auto eventStart = std::chrono::steady_clock::now();
+		int numTouches = static_cast<int>(record.x.size());
+		HPS::EventNotifier notifier;
+		switch (record.type)
+		{
+			case InputTrace::RecordType::TouchDown:
+				notifier = InjectTouchEvent(HPS::TouchEvent::Action::TouchDown, numTouches, record.x.data(), record.y.data(), record.ids.data(), record.tapCount);
+				break;
+			case InputTrace::RecordType::TouchMove:
+				notifier = InjectTouchEvent(HPS::TouchEvent::Action::Move, numTouches, record.x.data(), record.y.data(), record.ids.data());
+				break;
+			case InputTrace::RecordType::TouchUp:
+				notifier = InjectTouchEvent(HPS::TouchEvent::Action::TouchUp, numTouches, record.x.data(), record.y.data(), record.ids.data());
+				break;
+			case InputTrace::RecordType::TouchesCancel:
+				notifier = InjectTouchEvent(HPS::TouchEvent::Action::TouchUp, 0, 0, 0, 0);
+				break;
+			case InputTrace::RecordType::SingleTap:
+				singleTap(record.x[0], record.y[0]);
+				break;
+			case InputTrace::RecordType::DoubleTap:
+				doubleTap(record.x[0], record.y[0], record.ids[0]);
+				break;
+			case InputTrace::RecordType::SurfaceAction:
+				if (!replayAction(record.action, record.argument))
+					dprintf("replayTrace: %s can't be replayed\n", record.action.c_str());
+				break;
+		}
+
+		// The frame for the event can only be requested once the operators have handled it
+		if (!notifier.Empty())
+			notifier.Wait();
+		_canvas.UpdateWithNotifier().Wait();
+		frameTimes.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - eventStart).count());
+	}
+
+	stats.events = records.size();
+	stats.totalMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	if (!frameTimes.empty())
+	{
+		double total = 0;
+		for (double frameTime : frameTimes)
+			total += frameTime;
+		std::sort(frameTimes.begin(), frameTimes.end());
+
+		stats.meanFrameMilliseconds = total / frameTimes.size();
+		stats.medianFrameMilliseconds = frameTimes[frameTimes.size() / 2];
+		stats.p95FrameMilliseconds = frameTimes[(std::min)(frameTimes.size() - 1, frameTimes.size() * 95 / 100)];
+		stats.maxFrameMilliseconds = frameTimes.back();
+	}
+
+	return true;
+}
+
+void MobileSurface::recordAction(const char *name, const char *argument)
+{
+	_trace.recordAction(name, argument);
+}
+
 void MobileSurface::touchDown(int numTouches, int xposArray[], int yposArray[], HPS::TouchID idArray[], size_t tapCount)
 {
+	_trace.recordTouches(InputTrace::RecordType::TouchDown, numTouches, xposArray, yposArray, idArray, tapCount);
 	InjectTouchEvent(HPS::TouchEvent::Action::TouchDown, numTouches, xposArray, yposArray, idArray, tapCount);
 }
 
 void MobileSurface::touchMove(int numTouches, int xposArray[], int yposArray[], HPS::TouchID idArray[])
 {
+	_trace.recordTouches(InputTrace::RecordType::TouchMove, numTouches, xposArray, yposArray, idArray, 1);
 	InjectTouchEvent(HPS::TouchEvent::Action::Move, numTouches, xposArray, yposArray, idArray);
 }
 
 void MobileSurface::touchUp(int numTouches, int xposArray[], int yposArray[], HPS::TouchID idArray[])
 {
+	_trace.recordTouches(InputTrace::RecordType::TouchUp, numTouches, xposArray, yposArray, idArray, 1);
 	InjectTouchEvent(HPS::TouchEvent::Action::TouchUp, numTouches, xposArray, yposArray, idArray);
 }
 
 void MobileSurface::touchesCancel()
 {
+	_trace.recordTouches(InputTrace::RecordType::TouchesCancel, 0, 0, 0, 0, 1);
+
     // TouchUp event with empty touch array clears tracked touches
 	InjectTouchEvent(HPS::TouchEvent::Action::TouchUp, 0, 0, 0, 0);
 }
 
 void MobileSurface::singleTap(int x, int y)
 {
+	_trace.recordTap(InputTrace::RecordType::SingleTap, x, y, 0);
 	touchesCancel();
 }
 
 void MobileSurface::doubleTap(int x, int y, HPS::TouchID id)
 {
+	_trace.recordTap(InputTrace::RecordType::DoubleTap, x, y, id);
     touchesCancel();
 }
 
-void MobileSurface::InjectTouchEvent(HPS::TouchEvent::Action action, int numTouches, int xposArray[], int yposArray[], HPS::TouchID idArray[], size_t tapCount)
+HPS::EventNotifier MobileSurface::InjectTouchEvent(HPS::TouchEvent::Action action, int numTouches, int xposArray[], int yposArray[], HPS::TouchID idArray[], size_t tapCount)
 {
     if (!isValid())
-        return;
+        return HPS::EventNotifier();
     
 	HPS::WindowKey			windowKey = _canvas.GetWindowKey();
 	HPS::TouchArray			touches;
@@ -121,5 +281,5 @@ void MobileSurface::InjectTouchEvent(HPS::TouchEvent::Action action, int numTouc
 	}
 
 	HPS::TouchEvent			event(action, touches);
-	windowKey.GetEventDispatcher().InjectEvent(event);
+	return windowKey.GetEventDispatcher().InjectEventWithNotifier(event);
 }
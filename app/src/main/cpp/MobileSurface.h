@@ -6,6 +6,7 @@
 #ifdef USING_EXCHANGE
 #include "sprk_exchange.h"
 #endif
+#include "InputTrace.h"
 
 // MobileSurface is a plaform-independent base class which gui code will communicate with
 //  to handle surface creation/updates/destruction, as well as input events.
@@ -30,6 +31,13 @@ public:
     // Called to bind a window id to for HPS to render on to
 	virtual bool	bind(void *window);
 
+    // Called instead of bind() to render into an offscreen image, for hosts without a display or GPU.
+    // The software driver is used, so frames are the same on every machine that runs the same HPS build.
+	virtual bool	bindOffscreen(unsigned int width, unsigned int height);
+
+    // Reads back the last frame drawn by a surface bound with bindOffscreen()
+	bool			readFrame(HPS::ImageKit & image) const;
+
     // Called when the surface is about to become invalid
     virtual void    release(int flags);
 
@@ -51,13 +59,29 @@ public:
     // Return HPS::Canvas instance associated with this surface
 	HPS::Canvas		GetCanvas() const { return _canvas; }
 
+    // Records touches, taps and surface actions to a trace file until stopRecordingTrace() is called
+	bool			startRecordingTrace(const char *fileName);
+	bool			stopRecordingTrace();
+
+    // Plays a recorded trace back at the recorded pace, or as fast as frames are drawn if realTime is false.
+    // Blocks until the trace has been played, so it shouldn't be called from the gui thread.
+	bool			replayTrace(const char *fileName, bool realTime, InputTraceReplayStats & stats);
+
 protected:
-	void InjectTouchEvent(HPS::TouchEvent::Action action, int numTouches, int xposArray[], int yposArray[], HPS::TouchID idArray[], size_t tapCount = 1);
+    // Derived surfaces record their actions with recordAction(), and perform them again when replayAction() is called
+	void			recordAction(const char *name, const char *argument = "");
+	virtual bool	replayAction(std::string const & /*name*/, std::string const & /*argument*/) { return false; }
+
+	HPS::EventNotifier InjectTouchEvent(HPS::TouchEvent::Action action, int numTouches, int xposArray[], int yposArray[], HPS::TouchID idArray[], size_t tapCount = 1);
 
 private:
 	bool			_valid;
 	HPS::Canvas		_canvas;
+	InputTrace		_trace;
 };
 
 // Users must implement createMobileSurface() to return a pointer to their derived MobileSurface
-MobileSurface *createMobileSurface(int guiSurfaceId);
\ No newline at end of file
+MobileSurface *createMobileSurface(int guiSurfaceId);
+
+// Implemented by gui code to be told when an image exported in the background has been written
+void imageExported(bool success, const char *fileName);
@@ -2,6 +2,14 @@
 #include "dprintf.h"
 #include <string>
 #include <map>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <chrono>
+#include <cstring>
+#include <cstdlib>
+#include <sys/stat.h>
+#include <unistd.h>
 
 /**
  * UserMobileSurace.cpp
@@ -13,10 +21,16 @@
  *     in the Header file and provide a definition here. Run Sip.py accordingly, and the JNI + Java
  *     code should accurately reflect our changes.
  */
+static double millisecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
 UserMobileSurface::UserMobileSurface()
 :  displayResourceMonitor(false), currentRenderingMode(HPS::Rendering::Mode::Default), frameRateEnabled(false) { }
 
-UserMobileSurface::~UserMobileSurface() {}
+UserMobileSurface::~UserMobileSurface() {
+    waitForSessionWriter();
+}
 
 /* Bind Visualize Surface to the given Window (supplied by Android Java code.) */
 bool UserMobileSurface::bind(void *window) {
@@ -27,6 +41,9 @@ bool UserMobileSurface::bind(void *window) {
 
 void UserMobileSurface::release(int flags) {
     if ((flags & SCREEN_ROTATING) == 0) {
+        // The snapshot being written still reads the model
+        waitForSessionWriter();
+
         HPS::Canvas canvas = GetCanvas();
         HPS::Layout layout = canvas.GetAttachedLayout();
 
@@ -40,6 +57,10 @@ void UserMobileSurface::release(int flags) {
                     HPS::Model model = view.GetAttachedModel();
 
                     if (model.Type() != HPS::Type::None) {
+                        HPS::PickingIndex::Remove(model);
+                        HPS::InteractionLOD::Remove(model);
+                        HPS::MemoryBudget::Untrack(model);
+                        HPS::SceneOptimizer::Forget(model);
                         model.Delete();
                     }
 
@@ -101,7 +122,9 @@ bool UserMobileSurface::importPointCloudFile(const char * filename, HPS::Model c
 
         // Initiate import and wait.  Import is done on a separate thread.
         notifier = HPS::PointCloud::File::Import(filename, ioOpts);
+        auto parseStart = std::chrono::steady_clock::now();
         notifier.Wait();
+        lastImportStats.parseMilliseconds = millisecondsSince(parseStart);
 
         status = notifier.Status();
     }
@@ -132,7 +155,9 @@ bool UserMobileSurface::importHSFFile(const char * filename, HPS::Model const &
 
         // Initiate import and wait.  Import is done on a separate thread.
         notifier = HPS::Stream::File::Import(filename, ioOpts);
+        auto parseStart = std::chrono::steady_clock::now();
         notifier.Wait();
+        lastImportStats.parseMilliseconds = millisecondsSince(parseStart);
 
         status = notifier.Status();
     }
@@ -162,7 +187,9 @@ bool UserMobileSurface::importSTLFile(const char * filename, HPS::Model const &
 
         // Initiate import and wait.  Import is done on a separate thread.
         notifier = HPS::STL::File::Import(filename, ioOpts);
+        auto parseStart = std::chrono::steady_clock::now();
         notifier.Wait();
+        lastImportStats.parseMilliseconds = millisecondsSince(parseStart);
 
         status = notifier.Status();
     }
@@ -192,7 +219,9 @@ bool UserMobileSurface::importOBJFile(const char * filename, HPS::Model const &
 
         // Initiate import and wait.  Import is done on a separate thread.
         notifier = HPS::OBJ::File::Import(filename, ioOpts);
+        auto parseStart = std::chrono::steady_clock::now();
         notifier.Wait();
+        lastImportStats.parseMilliseconds = millisecondsSince(parseStart);
 
         status = notifier.Status();
     }
@@ -209,6 +238,14 @@ bool UserMobileSurface::importOBJFile(const char * filename, HPS::Model const &
 
 #ifdef USING_EXCHANGE
 
+// The keys of every component, which Exchange uses to find the segments and shells of the components
+static void collectComponentKeys(HPS::Component const & component, HPS::KeyArray & keys) {
+    HPS::KeyArray componentKeys = component.GetKeys();
+    keys.insert(keys.end(), componentKeys.begin(), componentKeys.end());
+    for (auto const & subcomponent : component.GetSubcomponents())
+        collectComponentKeys(subcomponent, keys);
+}
+
 bool UserMobileSurface::importExchangeFile(const char * filename, HPS::Exchange::ImportOptionsKit ioOpts)
 {
     HPS::IOResult           status = HPS::IOResult::Failure;
@@ -231,6 +268,10 @@ bool UserMobileSurface::importExchangeFile(const char * filename, HPS::Exchange:
 
         if (status == HPS::IOResult::Success)
         {
+            // Exchange reads the CAD file, then Visualize builds the scene graph from it
+            lastImportStats.parseMilliseconds = notifier.GetImportTime();
+            lastImportStats.insertMilliseconds = notifier.GetParseTime();
+
             activeCADModel = notifier.GetCADModel();
             HPS::View view = activeCADModel.ActivateDefaultCapture();
             GetCanvas().AttachViewAsLayout(view);
@@ -246,6 +287,31 @@ bool UserMobileSurface::importExchangeFile(const char * filename, HPS::Exchange:
 #endif
 
 bool UserMobileSurface::loadFile(const char* fileName) {
+    recordAction("loadFile", fileName);
+
+    lastImportStats = ImportStats();
+    lastImportStats.fileName = fileName;
+    ImportStats::resetPeakMemory();
+
+    auto start = std::chrono::steady_clock::now();
+    lastImportStats.success = importFile(fileName);
+    lastImportStats.totalMilliseconds = millisecondsSince(start);
+    lastImportStats.peakMemoryBytes = ImportStats::readPeakMemory();
+
+    dprintf("import stats: %s\n", lastImportStats.toJson().c_str());
+    return lastImportStats.success;
+}
+
+int UserMobileSurface::getImportStats(char* json, int capacity) {
+    std::string stats = lastImportStats.toJson();
+    if (capacity > 0) {
+        std::strncpy(json, stats.c_str(), capacity - 1);
+        json[capacity - 1] = '\0';
+    }
+    return static_cast<int>(stats.size());
+}
+
+bool UserMobileSurface::importFile(const char* fileName) {
     std::string fileNameStr(fileName);
     size_t loc = fileNameStr.find_last_of(".");
 
@@ -254,7 +320,7 @@ bool UserMobileSurface::loadFile(const char* fileName) {
 
     std::string extension = fileNameStr.substr(loc + 1, fileNameStr.size() - (loc + 1));
     std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
-
+    lastImportStats.format = extension;
 
     bool fit_world = false;
     if (extension == "hsf") {
@@ -345,10 +411,60 @@ bool UserMobileSurface::loadFile(const char* fileName) {
     HPS::View view = GetCanvas().GetFrontView();
     HPS::Model model = view.GetAttachedModel();
 
+    // The stats describe the model as imported
+    lastImportStats.collect(model);
+
+    // Merge the many small shells and segments of imported models, draw calls cost more than anything else on mobile GPUs
+    HPS::SceneOptimizer::Options optimizeOptions;
+#ifdef USING_EXCHANGE
+    // Exchange maps its components to the imported segments and shells, whose keys must be kept. Shells are still merged
+    // within the segments of the components, and the plain segments below them are collapsed
+    if (activeCADModel.Type() != HPS::Type::None) {
+        optimizeOptions.flatten_includes = false;
+        optimizeOptions.instance_shells = false;
+        collectComponentKeys(activeCADModel, optimizeOptions.mapped_keys);
+    }
+#endif
+    auto optimizeStart = std::chrono::steady_clock::now();
+    HPS::SceneOptimizer::Statistics optimized;
+    HPS::SceneOptimizer::Optimize(model, optimizeOptions, optimized);
+    lastImportStats.optimizeMilliseconds = millisecondsSince(optimizeStart);
+    dprintf("loadFile: %zu segments and %zu shells optimized to %zu segments and %zu shells, %zu includes flattened, %zu shells instanced from %zu prototypes\n",
+            optimized.segments_before, optimized.shells_before, optimized.segments_after, optimized.shells_after, optimized.includes_flattened,
+            optimized.shells_instanced, optimized.prototypes);
+
+    showModel(view, fit_world);
+
+    // Curved geometry is tessellated and display lists are built by the first update
+    auto firstFrameStart = std::chrono::steady_clock::now();
+    GetCanvas().UpdateWithNotifier().Wait();
+    lastImportStats.tessellationMilliseconds = millisecondsSince(firstFrameStart);
+
+    return true;
+}
+
+void UserMobileSurface::showModel(HPS::View & view, bool fitWorld) {
+    HPS::Model model = view.GetAttachedModel();
+
+    // Decimate the shells in the background, for the navigation operators to draw while the camera moves
+    HPS::InteractionLOD::GenerateAsync(model);
+
     // Enable static model for better performance
     model.GetSegmentKey().GetPerformanceControl().SetStaticModel(HPS::Performance::StaticModel::Attribute);
 
-    if (fit_world)
+    // Index the shells for analytic picking while the first frames are drawn
+    HPS::PickingIndex::BuildAsync(model);
+
+    // Estimate the memory of each segment, for far or hidden ones to be unloaded when the model is over budget.
+    // Unloading recreates the shells, which the component map of Exchange would not know about
+    bool trackMemory = true;
+#ifdef USING_EXCHANGE
+    trackMemory = activeCADModel.Type() == HPS::Type::None;
+#endif
+    if (trackMemory)
+        HPS::MemoryBudget::Track(view);
+
+    if (fitWorld)
         view.FitWorld();
 
     // setup scene defaults
@@ -356,14 +472,310 @@ bool UserMobileSurface::loadFile(const char* fileName) {
 
     // Add a distant light
     SetMainDistantLight();
+}
 
-    GetCanvas().UpdateWithNotifier().Wait();
+/* A session directory holds numbered snapshot directories, and a file naming the complete one. Each snapshot is written
+ * to a new directory, which replaces the previous one when the name file is renamed over. */
+static const char * const sessionCurrentFile = "/current";
+static const char * const sessionSnapshotPrefix = "snapshot.";
+static const char * const sessionModelFile = "/model.hsf";
+static const char * const sessionViewFile = "/view.hsf";
+static const char * const sessionStateFile = "/session.txt";
+static const char * const sessionTemporarySuffix = ".tmp";
+
+/* Markups and annotations live below this segment of the view, measurements below the same segment of the model. */
+static const char * const constructionSegmentName = "construction segments";
+
+/* Operators of the view which are restored with a session. Others are dropped. */
+static HPS::Operator * createSessionOperator(std::string const & name) {
+    if (name == "HPS_PanOrbitZoomOperator")
+        return new HPS::PanOrbitZoomOperator();
+    if (name == "HPS_ZoomFitTouchOperator")
+        return new HPS::ZoomFitTouchOperator();
+    if (name == "HPS_SelectOperator")
+        return new HPS::SelectOperator();
+    if (name == "HPS_HighlightOperator")
+        return new HPS::HighlightOperator();
+    if (name == "HPS_FlyOperator")
+        return new HPS::FlyOperator();
+    if (name == "HPS_WalkOperator")
+        return new HPS::WalkOperator();
+    if (name == "HPS_SimpleWalkOperator")
+        return new HPS::SimpleWalkOperator();
+    if (name == "HPS_CuttingSectionOperator")
+        return new HPS::CuttingSectionOperator();
+    if (name == "HPS_MarkupOperator")
+        return new HPS::MarkupOperator();
+    if (name == "HPS_AnnotationOperator")
+        return new HPS::AnnotationOperator();
+    if (name == "HPS_HandlesOperator")
+        return new HPS::HandlesOperator();
+    return nullptr;
+}
+
+static bool findSubsegment(HPS::SegmentKey const & segment, char const * name, HPS::SegmentKey & subsegment) {
+    HPS::SegmentKeyArray children;
+    segment.ShowSubsegments(children);
+    for (auto const & child : children) {
+        if (child.Name() == name) {
+            subsegment = child;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Proxies are saved along with the model they draw for, and generated again once it is restored
+static void removeProxySegments(HPS::SegmentKey const & segment) {
+    HPS::SegmentKeyArray children;
+    segment.ShowSubsegments(children);
+    for (auto & child : children) {
+        if (HPS::InteractionLOD::IsProxySegment(child) || HPS::MemoryBudget::IsProxySegment(child))
+            child.Delete();
+        else
+            removeProxySegments(child);
+    }
+}
+
+// Name of the complete snapshot of a session directory, empty if there is none
+static std::string readCurrentSnapshot(std::string const & directory) {
+    std::string name;
+    std::ifstream current((directory + sessionCurrentFile).c_str());
+    std::getline(current, name);
+    if (name.compare(0, std::strlen(sessionSnapshotPrefix), sessionSnapshotPrefix) != 0)
+        return std::string();
+    return name;
+}
+
+static void removeSnapshot(std::string const & snapshotDir) {
+    std::remove((snapshotDir + sessionModelFile).c_str());
+    std::remove((snapshotDir + sessionViewFile).c_str());
+    std::remove((snapshotDir + sessionStateFile).c_str());
+    rmdir(snapshotDir.c_str());
+}
+
+void UserMobileSurface::waitForSessionWriter() {
+    if (sessionWriter.joinable())
+        sessionWriter.join();
+}
+
+bool UserMobileSurface::saveSession(const char* sessionDir) {
+    HPS::View view = GetCanvas().GetFrontView();
+    if (view.Type() == HPS::Type::None)
+        return false;
+
+    HPS::Model model = view.GetAttachedModel();
+    if (model.Type() == HPS::Type::None)
+        return false;
+
+    // Only one snapshot is written at a time
+    waitForSessionWriter();
+
+    // State which is not part of the model is gathered right away, the model is only read by the writer
+    std::ostringstream state;
+    state << "rendering_mode " << static_cast<int>(currentRenderingMode) << "\n";
+
+    HPS::Vector lightDirection;
+    if (mainDistantLight.Type() != HPS::Type::None && mainDistantLight.ShowDirection(lightDirection))
+        state << "light " << lightDirection.x << " " << lightDirection.y << " " << lightDirection.z << "\n";
+
+    HPS::OperatorPtrArray operators;
+    if (view.GetOperatorControl().Show(operators)) {
+        for (auto const & op : operators)
+            state << "operator " << op->GetName() << "\n";
+    }
+
+    HPS::CameraKit camera;
+    view.GetSegmentKey().ShowCamera(camera);
+
+    HPS::SegmentKey construction;
+    bool hasConstruction = findSubsegment(view.GetSegmentKey(), constructionSegmentName, construction);
+
+    std::string directory(sessionDir);
+    std::string previousName = readCurrentSnapshot(directory);
+    unsigned long serial = previousName.empty() ? 0 : std::strtoul(previousName.c_str() + std::strlen(sessionSnapshotPrefix), nullptr, 10) + 1;
+    std::string snapshotName = sessionSnapshotPrefix + std::to_string(serial);
+    std::string stateText = state.str();
+
+    sessionWriter = std::thread([=]() {
+        auto start = std::chrono::steady_clock::now();
+        std::string snapshotDir = directory + "/" + snapshotName;
+
+        // Left over by a snapshot which failed half way
+        removeSnapshot(snapshotDir);
+        bool success = mkdir(snapshotDir.c_str(), 0700) == 0;
+
+        if (success) {
+            std::ofstream stateFile((snapshotDir + sessionStateFile).c_str());
+            stateFile << stateText;
+            stateFile.close();
+            success = !stateFile.fail();
+        }
 
+        // The model is exported as it is drawn, the shells unloaded by the budget are read back first and stay loaded
+        // until it is written. Proxies are written too, and deleted when the snapshot is restored
+        if (success)
+            success = HPS::MemoryBudget::LoadAll(model);
+
+        try {
+            if (success) {
+                // The camera comes back as the default camera of the model file, as for any other HSF file
+                HPS::Stream::ExportOptionsKit modelOptions;
+                modelOptions.SetDefaultCamera(camera);
+
+                HPS::Stream::ExportNotifier modelNotifier = HPS::Stream::File::Export((snapshotDir + sessionModelFile).c_str(), model.GetSegmentKey(), modelOptions);
+                modelNotifier.Wait();
+                success = modelNotifier.Status() == HPS::IOResult::Success;
+            }
+
+            if (success && hasConstruction) {
+                HPS::Stream::ExportNotifier viewNotifier = HPS::Stream::File::Export((snapshotDir + sessionViewFile).c_str(), construction, HPS::Stream::ExportOptionsKit());
+                viewNotifier.Wait();
+                success = viewNotifier.Status() == HPS::IOResult::Success;
+            }
+        }
+        catch (HPS::IOException const & ex) {
+            success = false;
+        }
+        HPS::MemoryBudget::Resume(model);
+
+        // Renaming the name file over is what switches to the new snapshot, up to then the previous one stays complete
+        if (success) {
+            std::string currentFile = directory + sessionCurrentFile;
+            std::ofstream current((currentFile + sessionTemporarySuffix).c_str());
+            current << snapshotName << "\n";
+            current.close();
+            success = !current.fail() && std::rename((currentFile + sessionTemporarySuffix).c_str(), currentFile.c_str()) == 0;
+            if (!success)
+                std::remove((currentFile + sessionTemporarySuffix).c_str());
+        }
+
+        if (success) {
+            if (!previousName.empty())
+                removeSnapshot(directory + "/" + previousName);
+            dprintf("saveSession: %s written in %.0f ms\n", snapshotName.c_str(), millisecondsSince(start));
+        }
+        else {
+            dprintf("saveSession: failed to write %s, keeping the previous snapshot\n", snapshotName.c_str());
+            removeSnapshot(snapshotDir);
+        }
+    });
+
+    return true;
+}
+
+bool UserMobileSurface::exportImage(const char* fileName, int width, int height) {
+    HPS::View view = GetCanvas().GetFrontView();
+    if (view.Type() == HPS::Type::None || width <= 0 || height <= 0)
+        return false;
+
+    std::string fileNameStr(fileName);
+    std::string::size_type loc = fileNameStr.find_last_of(".");
+    if (loc == std::string::npos)
+        return false;
+
+    std::string extension = fileNameStr.substr(loc + 1, fileNameStr.size() - (loc + 1));
+    std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+
+    HPS::Image::Format format;
+    if (extension == "png")
+        format = HPS::Image::Format::Png;
+    else if (extension == "jpg" || extension == "jpeg")
+        format = HPS::Image::Format::Jpeg;
+    else
+        return false;
+
+    // Rendering and encoding happen on the capture thread, the canvas keeps drawing in the meantime
+    return HPS::OffscreenCapture::Start(view, fileName, static_cast<unsigned int>(width), static_cast<unsigned int>(height), format,
+        [](bool success, HPS::UTF8 const & file) {
+            if (!success)
+                dprintf("exportImage: failed to write %s\n", file.GetBytes());
+            imageExported(success, file.GetBytes());
+        }, HPS::Window::Driver::OpenGL2);
+}
+
+bool UserMobileSurface::restoreSession(const char* sessionDir) {
+    std::string directory(sessionDir);
+    std::string snapshotName = readCurrentSnapshot(directory);
+    if (snapshotName.empty())
+        return false;
+
+    std::string snapshotDir = directory + "/" + snapshotName;
+    std::ifstream state((snapshotDir + sessionStateFile).c_str());
+    if (!state)
+        return false;
+
+    // Model, measurements and camera are all in the model file. It was optimized before it was saved, so it is only
+    // imported and shown rather than going through all of loadFile
+    HPS::Stream::ImportResultsKit results;
+    HPS::Model model = HPS::Factory::CreateModel();
+    if (!importHSFFile((snapshotDir + sessionModelFile).c_str(), model, results)) {
+        model.Delete();
+        return false;
+    }
+    removeProxySegments(model.GetSegmentKey());
+
+    HPS::View view = HPS::Factory::CreateView();
+    view.AttachModel(model);
+    GetCanvas().AttachViewAsLayout(view);
+
+    HPS::CameraKit camera;
+    bool hasCamera = results.ShowDefaultCamera(camera);
+    if (hasCamera)
+        view.GetSegmentKey().SetCamera(camera);
+    showModel(view, !hasCamera);
+
+    HPS::OperatorPtrArray operators;
+    std::string line;
+    while (std::getline(state, line)) {
+        std::istringstream fields(line);
+        std::string field;
+        fields >> field;
+
+        if (field == "rendering_mode") {
+            int mode;
+            if (fields >> mode) {
+                currentRenderingMode = static_cast<HPS::Rendering::Mode>(mode);
+                view.SetRenderingMode(currentRenderingMode);
+            }
+        }
+        else if (field == "light") {
+            HPS::Vector lightDirection;
+            if (fields >> lightDirection.x >> lightDirection.y >> lightDirection.z)
+                SetMainDistantLight(lightDirection);
+        }
+        else if (field == "operator") {
+            std::string name;
+            fields >> name;
+            HPS::Operator * op = createSessionOperator(name);
+            if (op != nullptr)
+                operators.push_back(HPS::OperatorPtr(op));
+        }
+    }
+
+    if (!operators.empty())
+        view.GetOperatorControl().Set(operators);
+
+    // Markups and annotations
+    std::string viewFile = snapshotDir + sessionViewFile;
+    if (std::ifstream(viewFile.c_str())) {
+        try {
+            HPS::Stream::ImportOptionsKit ioOpts;
+            ioOpts.SetSegment(view.GetSegmentKey().Subsegment(constructionSegmentName));
+            HPS::Stream::File::Import(viewFile.c_str(), ioOpts).Wait();
+        }
+        catch (HPS::IOException const & ex) {
+            dprintf("restoreSession: failed to read markups\n");
+        }
+    }
+
+    GetCanvas().Update();
     return true;
 }
 
 void UserMobileSurface::setOperatorOrbit()
 {
+    recordAction("setOperatorOrbit");
     GetCanvas().GetFrontView().GetOperatorControl().Pop();
     GetCanvas().GetFrontView().GetOperatorControl().Push(new HPS::PanOrbitZoomOperator());
 }
@@ -372,6 +784,8 @@ void UserMobileSurface::onModeSimpleShadow(bool enable) {
     if (!isValid())
         return;
 
+    recordAction("onModeSimpleShadow", enable ? "1" : "0");
+
     if (enable == true) {
         // Set simple shadow options
         const float                 opacity = 0.3f;
@@ -396,6 +810,8 @@ void UserMobileSurface::onModeSmooth() {
     if (!isValid())
         return;
 
+    recordAction("onModeSmooth");
+
     // Toggle Phong on/off
     if (currentRenderingMode == HPS::Rendering::Mode::Phong)
         currentRenderingMode = HPS::Rendering::Mode::Default;
@@ -410,6 +826,8 @@ void UserMobileSurface::onModeHiddenLine() {
     if (!isValid())
         return;
 
+    recordAction("onModeHiddenLine");
+
     // Toggle hidden line
     if (currentRenderingMode == HPS::Rendering::Mode::FastHiddenLine)
         currentRenderingMode = HPS::Rendering::Mode::Default;
@@ -429,22 +847,68 @@ void UserMobileSurface::onModeHiddenLine() {
     GetCanvas().Update();
 }
 
+bool UserMobileSurface::startTrace(const char* fileName) {
+    return startRecordingTrace(fileName);
+}
+
+bool UserMobileSurface::stopTrace() {
+    return stopRecordingTrace();
+}
+
+bool UserMobileSurface::playTrace(const char* fileName, bool realTime) {
+    InputTraceReplayStats stats;
+    if (!replayTrace(fileName, realTime, stats))
+        return false;
+
+    dprintf("playTrace: %zu events in %.1f ms, frame mean %.2f ms, median %.2f ms, p95 %.2f ms, max %.2f ms, lag %.2f ms\n",
+        stats.events, stats.totalMilliseconds, stats.meanFrameMilliseconds, stats.medianFrameMilliseconds,
+        stats.p95FrameMilliseconds, stats.maxFrameMilliseconds, stats.maxLagMilliseconds);
+    return true;
+}
+
+// Performs an action recorded by recordAction() again. Snapshots and exports are not recorded, they don't affect what is drawn
+bool UserMobileSurface::replayAction(std::string const & name, std::string const & argument) {
+    if (name == "loadFile")
+        return loadFile(argument.c_str());
+    else if (name == "setOperatorOrbit")
+        setOperatorOrbit();
+    else if (name == "onModeSimpleShadow")
+        onModeSimpleShadow(argument == "1");
+    else if (name == "onModeSmooth")
+        onModeSmooth();
+    else if (name == "onModeHiddenLine")
+        onModeHiddenLine();
+    else if (name == "onUserCode1")
+        onUserCode1();
+    else if (name == "onUserCode2")
+        onUserCode2();
+    else if (name == "onUserCode3")
+        onUserCode3();
+    else
+        return false;
+
+    return true;
+}
+
 void UserMobileSurface::onUserCode1() {
+    recordAction("onUserCode1");
     // TODO: Enable Shadows!
     dprintf("user code 1\n");
 }
 
 void UserMobileSurface::onUserCode2() {
+    recordAction("onUserCode2");
     // TODO: Cycle Render modes.
     dprintf("user code 2\n");
 }
 
 void UserMobileSurface::onUserCode3() {
+    recordAction("onUserCode3");
     // TODO: Select Node and display information.
     dprintf("user code 3\n");
 }
 
 void UserMobileSurface::onUserCode4() {
-    // TODO: Save output to screenshot.
+    // Screenshots are written by exportImage(), since the gui chooses where they go
     dprintf("user code 4\n");
 }
\ No newline at end of file
@@ -1,6 +1,9 @@
 #pragma once
 
 #include "MobileSurface.h"
+#include "ImportStats.h"
+
+#include <thread>
 
 #define SURFACE_ACTION
 
@@ -75,6 +78,21 @@ public:
 
     SURFACE_ACTION bool		loadFile(const char *fileName);
 
+    // Statistics of the last loadFile as JSON, truncated to fit capacity. Returns the length of the whole JSON
+    SURFACE_ACTION int		getImportStats(char *json, int capacity);
+
+    // Session snapshot written in the background, to be restored after the process is killed
+    SURFACE_ACTION bool		saveSession(const char *sessionDir);
+    SURFACE_ACTION bool		restoreSession(const char *sessionDir);
+
+    // Renders the front view offscreen and writes it as a png or jpg file in the background, the gui is told through imageExported()
+    SURFACE_ACTION bool		exportImage(const char *fileName, int width, int height);
+
+    // Input traces, to reproduce and time interaction. Replays block, so they shouldn't be started from the gui thread
+    SURFACE_ACTION bool		startTrace(const char *fileName);
+    SURFACE_ACTION bool		stopTrace();
+    SURFACE_ACTION bool		playTrace(const char *fileName, bool realTime);
+
     SURFACE_ACTION void		setOperatorOrbit();
 
     SURFACE_ACTION void		onModeSimpleShadow(bool enable);
@@ -86,6 +104,9 @@ public:
     SURFACE_ACTION void		onUserCode3();
     SURFACE_ACTION void		onUserCode4();
 
+protected:
+    virtual bool			replayAction(std::string const & name, std::string const & argument);
+
 private:
 
 #ifdef USING_EXCHANGE
@@ -99,6 +120,16 @@ private:
     HPS::Rendering::Mode	currentRenderingMode;
     bool                    frameRateEnabled;
 
+    // Thread waiting for the exports of the last session snapshot
+    std::thread             sessionWriter;
+    void                    waitForSessionWriter();
+
+    // What the last loadFile brought in and what it cost
+    ImportStats             lastImportStats;
+    bool                    importFile(const char *fileName);
+    // Builds the caches of a model attached to the front view and sets up the scene around it
+    void                    showModel(HPS::View & view, bool fitWorld);
+
     void 					loadCamera(HPS::View & view, HPS::Stream::ImportResultsKit const & results);
     bool importHSFFile(const char * filename, HPS::Model const & model, HPS::Stream::ImportResultsKit &);
     bool importSTLFile(const char * filename, HPS::Model const & model);
@@ -1,18 +1,10 @@
 #pragma once
 
 #ifndef dprintf
-	#if TARGET_OS_ANDROID
-		#include <android/log.h>
+	// Messages are queued and written to the platform log by a background thread, see AsyncLog.h
+	#include "AsyncLog.h"
 
-		#define LOG_TAG "SandboxApp"
-		#define dprintf(...) ((void)__android_log_print(ANDROID_LOG_DEBUG, LOG_TAG, __VA_ARGS__))
-		#define eprintf(...) ((void)__android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__))
-		#define wprintf(...) ((void)__android_log_print(ANDROID_LOG_WARN, LOG_TAG, __VA_ARGS__))
-	#else
-		#include <stdio.h>
-		#define dprintf(...) printf(__VA_ARGS__)
-        #define eprintf(...) printf(__VA_ARGS__)
-        #define wprintf(...) printf(__VA_ARGS__)
-	#endif
+	#define dprintf(...) AsyncLog::write(AsyncLog::Level::Debug, __VA_ARGS__)
+	#define eprintf(...) AsyncLog::write(AsyncLog::Level::Error, __VA_ARGS__)
+	#define wprintf(...) AsyncLog::write(AsyncLog::Level::Warning, __VA_ARGS__)
 #endif
-
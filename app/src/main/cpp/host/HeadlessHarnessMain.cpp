@@ -0,0 +1,57 @@
+#include "HeadlessHarness.h"
+#include "MobileApp.h"
+#include "dprintf.h"
+#include <algorithm>
+#include <cstdlib>
+
+/**
+ * HeadlessHarnessMain.cpp
+ *  - Renders the bundled datasets on an offscreen surface and compares them against reference images.
+ *
+ *  Usage: headless_harness <assets dir> <reference dir> <output dir> [width height]
+ *   - <assets dir> is app/src/main/assets, which holds the datasets and the fonts.
+ *   - The process exits with 1 if a dataset mismatched its reference or failed to render.
+ */
+
+// Exported images are only logged, there is no gui to tell
+void imageExported(bool success, const char *fileName) {
+    dprintf("%s %s\n", success ? "exported" : "failed to export", fileName);
+}
+
+int main(int argc, char *argv[]) {
+    if (argc != 4 && argc != 6) {
+        eprintf("usage: %s <assets dir> <reference dir> <output dir> [width height]\n", argv[0]);
+        return 2;
+    }
+
+    std::string assetsDirectory(argv[1]);
+    unsigned int width = argc == 6 ? static_cast<unsigned int>(std::atoi(argv[4])) : 1280;
+    unsigned int height = argc == 6 ? static_cast<unsigned int>(std::atoi(argv[5])) : 720;
+
+    MobileApp::inst().setFontDirectory((assetsDirectory + "/fonts").c_str());
+    MobileApp::inst().setMaterialsDirectory((assetsDirectory + "/materials").c_str());
+
+    HeadlessHarness harness(width, height);
+    harness.setReferenceDirectory(argv[2]);
+    harness.setOutputDirectory(argv[3]);
+
+    // Each dataset is drawn from the camera loadFile fits to it
+    std::vector<HeadlessHarness::Case> cases;
+    for (const char *dataset : { "conrod", "bnc" }) {
+        HeadlessHarness::Case test;
+        test.name = dataset;
+        test.fileName = assetsDirectory + "/datasets/" + dataset + ".hsf";
+        cases.push_back(test);
+    }
+
+    std::vector<HeadlessHarness::Result> results = harness.run(cases);
+
+    // Screenshots larger than a tile are assembled from tiles, which have to match a capture in one piece
+    for (auto const & test : cases)
+        results.push_back(harness.runTiledCapture(test, (std::max)(width, height) / 3 + 1));
+
+    bool passed = HeadlessHarness::report(results);
+
+    MobileApp::inst().shutdown();
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,190 @@
+#include "UserMobileSurface.h"
+#include "MobileApp.h"
+#include "dprintf.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <string>
+#include <vector>
+
+/**
+ * OperatorBenchmark.cpp
+ *  - Feeds synthetic mouse and touch streams into each operator and measures what every event costs.
+ *
+ *  Usage: operator_benchmark <dataset file> [moves per stream] [repetitions]
+ *   - Handlers are called directly rather than through the event dispatcher, so the times are those of the operators.
+ *     The updates they request are drawn between streams, and are not part of the times.
+ */
+
+// Exported images are only logged, there is no gui to tell
+void imageExported(bool success, const char *fileName) {
+    dprintf("%s %s\n", success ? "exported" : "failed to export", fileName);
+}
+
+namespace {
+    const unsigned int surfaceWidth = 1280;
+    const unsigned int surfaceHeight = 720;
+
+    typedef std::chrono::steady_clock Clock;
+
+    struct OperatorCase {
+        const char *name;
+        std::function<HPS::Operator *()> create;
+    };
+
+    // Samples of one kind of event, in microseconds
+    struct Samples {
+        std::vector<double> values;
+
+        void report(const char *operatorName, const char *input, const char *event) {
+            if (values.empty())
+                return;
+            std::sort(values.begin(), values.end());
+            double total = 0;
+            for (double value : values)
+                total += value;
+            dprintf("%-24s %-6s %-5s n %6zu  mean %9.2f us  median %9.2f us  p95 %9.2f us  max %9.2f us\n",
+                operatorName, input, event, values.size(), total / values.size(), values[values.size() / 2],
+                values[std::min(values.size() - 1, values.size() * 95 / 100)], values.back());
+        }
+    };
+
+    template <typename Handler>
+    void timeEvent(Samples & samples, Handler const & handler) {
+        auto start = Clock::now();
+        handler();
+        samples.values.push_back(std::chrono::duration<double, std::micro>(Clock::now() - start).count());
+    }
+
+    // The stream circles around the center of the window, as a drag would
+    HPS::WindowPoint streamPoint(int move, int moves, float radius) {
+        float angle = 6.2831853f * move / std::max(moves, 1);
+        return HPS::WindowPoint(radius * std::cos(angle), radius * std::sin(angle), 0);
+    }
+
+    void runMouseStream(HPS::Operator & op, HPS::KeyArray const & path, int moves, Samples & down, Samples & move, Samples & up) {
+        HPS::MouseButtons buttons = HPS::MouseButtons::ButtonLeft();
+        HPS::MouseState state;
+
+        HPS::WindowPoint point(0, 0, 0);
+        state.Set(path, HPS::MouseEvent(HPS::MouseEvent::Action::ButtonDown, point, buttons, HPS::ModifierKeys(), 1), point, buttons);
+        timeEvent(down, [&]() { op.OnMouseDown(state); });
+
+        for (int i = 1; i <= moves; ++i) {
+            point = streamPoint(i, moves, 0.5f);
+            state.Set(path, HPS::MouseEvent(HPS::MouseEvent::Action::Move, point, buttons), point, buttons);
+            timeEvent(move, [&]() { op.OnMouseMove(state); });
+        }
+
+        state.Set(path, HPS::MouseEvent(HPS::MouseEvent::Action::ButtonUp, point, buttons), point, HPS::MouseButtons());
+        timeEvent(up, [&]() { op.OnMouseUp(state); });
+    }
+
+    // Two fingers, so that operators which pinch or pan with two touches take their multi-touch paths as well
+    void runTouchStream(HPS::Operator & op, HPS::KeyArray const & path, int moves, Samples & down, Samples & move, Samples & up) {
+        HPS::TouchState state;
+        HPS::TouchArray touches(2);
+
+        touches[0] = HPS::Touch(1, HPS::WindowPoint(-0.1f, 0, 0));
+        touches[1] = HPS::Touch(2, HPS::WindowPoint(0.1f, 0, 0));
+        state.Set(path, HPS::TouchEvent(HPS::TouchEvent::Action::TouchDown, touches), touches);
+        timeEvent(down, [&]() { op.OnTouchDown(state); });
+
+        for (int i = 1; i <= moves; ++i) {
+            HPS::WindowPoint center = streamPoint(i, moves, 0.3f);
+            float spread = 0.1f + 0.2f * i / moves;
+            touches[0] = HPS::Touch(1, HPS::WindowPoint(center.x - spread, center.y, 0));
+            touches[1] = HPS::Touch(2, HPS::WindowPoint(center.x + spread, center.y, 0));
+            state.Set(path, HPS::TouchEvent(HPS::TouchEvent::Action::Move, touches), touches);
+            timeEvent(move, [&]() { op.OnTouchMove(state); });
+        }
+
+        state.Set(path, HPS::TouchEvent(HPS::TouchEvent::Action::TouchUp, touches), HPS::TouchArray());
+        timeEvent(up, [&]() { op.OnTouchUp(state); });
+    }
+}
+
+int main(int argc, char *argv[]) {
+    if (argc < 2 || argc > 4) {
+        eprintf("usage: %s <dataset file> [moves per stream] [repetitions]\n", argv[0]);
+        return 2;
+    }
+
+    int moves = argc > 2 ? std::max(std::atoi(argv[2]), 1) : 200;
+    int repetitions = argc > 3 ? std::max(std::atoi(argv[3]), 1) : 5;
+
+    UserMobileSurface surface;
+    if (!surface.bindOffscreen(surfaceWidth, surfaceHeight) || !surface.loadFile(argv[1])) {
+        eprintf("could not load %s\n", argv[1]);
+        return 1;
+    }
+
+    HPS::Canvas canvas = surface.GetCanvas();
+    HPS::View view = canvas.GetFrontView();
+    HPS::KeyArray path = { view.GetSegmentKey(), canvas.GetAttachedLayout().GetSegmentKey(), canvas.GetWindowKey() };
+
+    // The loaded operators are set aside, so that each operator runs on its own
+    HPS::OperatorPtrArray loadedOperators;
+    view.GetOperatorControl().Show(loadedOperators);
+    view.GetOperatorControl().UnsetEverything();
+
+    HPS::CameraKit camera;
+    view.GetSegmentKey().ShowCamera(camera);
+
+    // Every operator is triggered by the left button, which the mouse streams hold down
+    HPS::MouseButtons left = HPS::MouseButtons::ButtonLeft();
+    std::vector<OperatorCase> operators = {
+        { "PanOrbitZoomOperator", [&]() { return new HPS::PanOrbitZoomOperator(left); } },
+        { "PanOperator", [&]() { return new HPS::PanOperator(left); } },
+        { "OrbitOperator", [&]() { return new HPS::OrbitOperator(left); } },
+        { "RelativeOrbitOperator", [&]() { return new HPS::RelativeOrbitOperator(left); } },
+        { "ZoomOperator", [&]() { return new HPS::ZoomOperator(left); } },
+        { "ZoomBoxOperator", [&]() { return new HPS::ZoomBoxOperator(left); } },
+        { "SelectAreaOperator", [&]() { return new HPS::SelectAreaOperator(left); } },
+        { "HighlightAreaOperator", [&]() { return new HPS::HighlightAreaOperator(left); } },
+        { "SelectOperator", [&]() { return new HPS::SelectOperator(left); } },
+        { "HighlightOperator", [&]() { return new HPS::HighlightOperator(left); } },
+        { "TurntableOperator", [&]() { return new HPS::TurntableOperator(left); } },
+        { "ZoomFitTouchOperator", [&]() { return new HPS::ZoomFitTouchOperator(); } },
+        { "FlyOperator", [&]() { return new HPS::FlyOperator(left); } },
+        { "WalkOperator", [&]() { return new HPS::WalkOperator(left); } },
+        { "SimpleWalkOperator", [&]() { return new HPS::SimpleWalkOperator(left); } },
+        { "CuttingSectionOperator", [&]() { return new HPS::CuttingSectionOperator(left); } },
+        { "MarkupOperator", [&]() { return new HPS::MarkupOperator(left); } },
+        { "AnnotationOperator", [&]() { return new HPS::AnnotationOperator(left); } },
+        { "HandlesOperator", [&]() { return new HPS::HandlesOperator(left); } },
+    };
+
+    for (auto const & operatorCase : operators) {
+        Samples mouseDown, mouseMove, mouseUp, touchDown, touchMove, touchUp;
+
+        for (int repetition = 0; repetition < repetitions; ++repetition) {
+            // A new operator for every stream, so that no state is carried over from the previous one
+            HPS::OperatorPtr op(operatorCase.create());
+            view.GetOperatorControl().Push(op);
+
+            runMouseStream(*op, path, moves, mouseDown, mouseMove, mouseUp);
+            canvas.UpdateWithNotifier(HPS::Window::UpdateType::Complete).Wait();
+
+            runTouchStream(*op, path, moves, touchDown, touchMove, touchUp);
+            canvas.UpdateWithNotifier(HPS::Window::UpdateType::Complete).Wait();
+
+            view.GetOperatorControl().UnsetEverything();
+            view.GetSegmentKey().SetCamera(camera);
+        }
+
+        mouseDown.report(operatorCase.name, "mouse", "down");
+        mouseMove.report(operatorCase.name, "mouse", "move");
+        mouseUp.report(operatorCase.name, "mouse", "up");
+        touchDown.report(operatorCase.name, "touch", "down");
+        touchMove.report(operatorCase.name, "touch", "move");
+        touchUp.report(operatorCase.name, "touch", "up");
+    }
+
+    view.GetOperatorControl().Set(loadedOperators);
+    surface.release(0);
+    MobileApp::inst().shutdown();
+    return 0;
+}
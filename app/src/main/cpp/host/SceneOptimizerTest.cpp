@@ -0,0 +1,114 @@
+#include "UserMobileSurface.h"
+#include "MobileApp.h"
+#include "dprintf.h"
+#include "sprk_ops.h"
+#include <cmath>
+#include <string>
+
+/**
+ * SceneOptimizerTest.cpp
+ *  - Checks that the SceneOptimizer instances copies of a shell wherever they are placed.
+ *
+ *  Usage: scene_optimizer_test
+ *   - The copies are rotated and moved far from the origin, where their points only match the ones of the prototype
+ *     up to float error, so they would not be found if the test for copies were exact.
+ *   - Exits with 1 if any copy is left alone.
+ */
+
+// Nothing is exported, but the app code expects the callback
+void imageExported(bool success, const char *fileName) {
+    dprintf("%s %s\n", success ? "exported" : "failed to export", fileName);
+}
+
+namespace {
+    const unsigned int surfaceWidth = 64;
+    const unsigned int surfaceHeight = 64;
+
+    const int ringSegments = 12;
+    const int tubeSegments = 6;
+
+    // A torus with an uneven cross section, so that no rotation maps it onto itself
+    void makeTube(HPS::PointArray & points, HPS::IntArray & faceList) {
+        for (int i = 0; i < ringSegments; ++i) {
+            float ringAngle = 6.2831853f * i / ringSegments;
+            for (int j = 0; j < tubeSegments; ++j) {
+                float tubeAngle = 6.2831853f * j / tubeSegments;
+                float tubeRadius = 0.5f + 0.1f * j + 0.05f * (i % 3);
+                float distance = 3.0f + tubeRadius * std::cos(tubeAngle);
+                points.push_back(HPS::Point(distance * std::cos(ringAngle), distance * std::sin(ringAngle), 1.5f * tubeRadius * std::sin(tubeAngle)));
+            }
+        }
+
+        for (int i = 0; i < ringSegments; ++i) {
+            int nextI = (i + 1) % ringSegments;
+            for (int j = 0; j < tubeSegments; ++j) {
+                int nextJ = (j + 1) % tubeSegments;
+                faceList.push_back(4);
+                faceList.push_back(i * tubeSegments + j);
+                faceList.push_back(nextI * tubeSegments + j);
+                faceList.push_back(nextI * tubeSegments + nextJ);
+                faceList.push_back(i * tubeSegments + nextJ);
+            }
+        }
+    }
+
+    struct Placement {
+        float rotation[3];
+        float translation[3];
+    };
+
+    const Placement copies[] = {
+        { { 0, 0, 0 }, { 0, 0, 0 } },
+        { { 0, 0, 90 }, { 1.0e5f, 0, 0 } },
+        { { 30, 45, 60 }, { -1.0e5f, 2.5e5f, 0 } },
+        { { 170, -20, 5 }, { 3.0e5f, -1.0e5f, 7.5e4f } },
+        { { -60, 10, 135 }, { 123456.7f, 98765.4f, -54321.1f } },
+    };
+    const size_t copyCount = sizeof(copies) / sizeof(copies[0]);
+}
+
+int main(int argc, char *argv[]) {
+    if (argc != 1) {
+        eprintf("usage: %s\n", argv[0]);
+        return 2;
+    }
+
+    UserMobileSurface surface;
+    if (!surface.bindOffscreen(surfaceWidth, surfaceHeight)) {
+        eprintf("could not bind an offscreen surface\n");
+        return 1;
+    }
+
+    HPS::PointArray points;
+    HPS::IntArray faceList;
+    makeTube(points, faceList);
+
+    HPS::Model model = HPS::Factory::CreateModel();
+    for (size_t i = 0; i < copyCount; ++i) {
+        HPS::MatrixKit matrix;
+        matrix.Rotate(copies[i].rotation[0], copies[i].rotation[1], copies[i].rotation[2]);
+        matrix.Translate(copies[i].translation[0], copies[i].translation[1], copies[i].translation[2]);
+
+        // The points are moved rather than the segment, so that the copies are only equal up to float error
+        HPS::SegmentKey part = model.GetSegmentKey().Subsegment(("part " + std::to_string(i)).c_str());
+        part.InsertShell(matrix.Transform(points), faceList);
+    }
+
+    HPS::SceneOptimizer::Options options;
+    options.flatten_includes = false;
+    options.merge_shells = false;
+
+    HPS::SceneOptimizer::Statistics statistics;
+    bool optimized = HPS::SceneOptimizer::Optimize(model, options, statistics);
+    dprintf("shells %zu, instanced %zu, prototypes %zu\n", statistics.shells_before, statistics.shells_instanced, statistics.prototypes);
+
+    bool passed = optimized && statistics.shells_instanced == copyCount && statistics.prototypes == 1;
+    if (!passed)
+        eprintf("expected %zu shells instanced from 1 prototype\n", copyCount);
+
+    HPS::SceneOptimizer::Forget(model);
+    model.Delete();
+    surface.release(0);
+    MobileApp::inst().shutdown();
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,48 @@
+#include "UserMobileSurface.h"
+#include "MobileApp.h"
+#include "dprintf.h"
+#include <cstring>
+#include <vector>
+
+/**
+ * TraceReplay.cpp
+ *  - Replays an input trace recorded on a device on an offscreen surface of the recorded size, and prints its frame times.
+ *
+ *  Usage: trace_replay <trace file> [--real-time]
+ *   - Traces start with the loadFile action of the model they were recorded on, the file has to be found at the same path.
+ *   - Running the same trace against two builds gives the A/B comparison of a change.
+ */
+
+// Exported images are only logged, there is no gui to tell
+void imageExported(bool success, const char *fileName) {
+    dprintf("%s %s\n", success ? "exported" : "failed to export", fileName);
+}
+
+int main(int argc, char *argv[]) {
+    if (argc < 2 || argc > 3 || (argc == 3 && std::strcmp(argv[2], "--real-time") != 0)) {
+        eprintf("usage: %s <trace file> [--real-time]\n", argv[0]);
+        return 2;
+    }
+
+    std::vector<InputTrace::Record> records;
+    unsigned int width, height;
+    if (!InputTrace::load(argv[1], records, width, height) || width == 0 || height == 0) {
+        eprintf("could not read %s\n", argv[1]);
+        return 1;
+    }
+
+    UserMobileSurface surface;
+    InputTraceReplayStats stats;
+    if (!surface.bindOffscreen(width, height) || !surface.replayTrace(argv[1], argc == 3, stats)) {
+        eprintf("could not replay %s\n", argv[1]);
+        return 1;
+    }
+
+    dprintf("events %zu  total %.1f ms  frame mean %.2f ms  median %.2f ms  p95 %.2f ms  max %.2f ms  lag %.2f ms\n",
+        stats.events, stats.totalMilliseconds, stats.meanFrameMilliseconds, stats.medianFrameMilliseconds,
+        stats.p95FrameMilliseconds, stats.maxFrameMilliseconds, stats.maxLagMilliseconds);
+
+    surface.release(0);
+    MobileApp::inst().shutdown();
+    return 0;
+}
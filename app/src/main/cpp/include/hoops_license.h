@@ -1,7 +0,0 @@
-
-#ifndef HOOPS_LICENSE_DEFINED
-#   define HOOPS_LICENSE_DEFINED
-#   define HOOPS_LICENSE "4DR41CR4Dji21uM50AIP4eMWCVaz1AQZvSnm9uMH8eF7DxYPD4LLjBII5vmGBhV1BynnuTbsCiV47Uyw4ENk9U7sBidFjDiVwuRa1jr51TVsCDqYEiJy8zbr8QJ13TMW5fiJ9Djb1EBq1Enm1SVtDTq24E652wF9wBiW5Ej6wCf45hI1Cynd9C2L2hm58FazAUaUBeFu0vUY7Rm8wxZrBgmM4TIS9UR37RNnEjmKvVaE0y739yv28ktPj7F42gQRGrPFjEaIBULGj7DFACUV8LtKj7FuBgMzj7DFjCiM3EUY0Tm60xfaATUUwCFoAEy55xro2EqOxCrvwwNmCDI74wZrzSjqDUiLCuF24vZ2ACb22CAI5EF3CxeIBQUW2QML5sQYzyYgj7DFyrHFjDV70TqX0w6L1wqL5FmWDEu0Eg2I0VeUDFi09U3$By2zBVmT3UB1DSeZAwqV1CN9vVm23uELwwQ01Bm18wV97VqzCQJa1ie51yy58CyKvFq23TV18FqS5yF2DuNcvQRtAEJ8zUz03inxwyUS8QQKAgbq4BZuCfYP8gQRBBUM1wfx4xq_DuFd3UN62RJ32Sm74wIWCgAR1Uj58E35ATa6xEr0Agy48SN53iz55CNaDw6W8DQSwieW5gA4ChiJxTZsxwjc9DM54uQJ1ymWwwuSDEuG1RVtwSQQDAQ5vCQT3QY_9E788S7o5gyNDFn4AuR0wTfm5CZ68VeXxhr7wjeWEeFk0Ua02CaGwfm04zn0vEBrj7DFjBnvwTdFj7DFxuVkwTM3vAVlxeI3xTM0xRm6xhU1xAVlvUblwbFm8uY37QVkxuU7vTRkvTZn9fnpwhZpwhM3xTY6xRa3vBfpxTI4xfm58xU28hJnvAJl8QJmwAU37TU0vBjnvRe1xAUzwxM89ia87TQ5xQU2xTU6wQFo8ya3vTQ2xUbn8Be48vmzxANo8eZl8QY08Rbo8eIzweRpwAE0wTM08eY68RjoweI5wuQ8vBnlxRnnvTJnxTNkvTI58AM6xEa8vQZlvQY78UbnwRjpwhI6xiazvTQ07Ua78QJmxBm48hU58vez8DU5vRa8vANo8DVnxBm49fi1whI18xY28hYzxBa08uY6wuEzxhZnwBe6wuYzwia5xeIzxhNn8fe7xuY3wQU2xUa57QNo7TJmwiblxxM7vAUzwQY5vBi8whVk8QNp8vnk9hZlweVn8hRkxhI4xQRoxeQ0vTZkxhY2w7F43gVo"
-#   define VISUALIZE_LICENSE HOOPS_LICENSE
-#endif
-
@@ -5957,6 +5957,32 @@ public:
 		/*! Delete the current measurement and brings the operator back to a state to start a new measurement */
 		void DeleteLastMeasurement();
 
+		/*! The BatchMeasurement class describes a single measurement computed by MeasureBatch, and receives its result. */
+		class EXCHANGE_API BatchMeasurement
+		{
+		public:
+			BatchMeasurement();
+
+			MeasurementType		type;								//!< EdgeAndRadius, FeatureToFeature or FaceAngle
+			ComponentPath		first;								//!< the edge to measure for EdgeAndRadius, the first face otherwise
+			ComponentPath		second;								//!< the second face, for FeatureToFeature and FaceAngle
+
+			bool				success;							//!< whether the measurement could be computed
+			float				value;								//!< the edge length or radius, the distance, or the angle in degrees
+			bool				is_radius;							//!< for EdgeAndRadius, whether value is the radius of a circular edge
+			Point				point_one;							//!< the world space start of the measured distance, or the circle center
+			Point				point_two;							//!< the world space end of the measured distance
+		};
+
+		/*! Computes the measurements described by io_measurements without inserting any geometry in the scene.
+		* Topology is resolved on the calling thread, while the distance computations are spread over worker threads.
+		* PointToPoint measurements are not supported, since they do not depend on the model topology.
+		* For FaceAngle measurements, value is the angle between the normals of the two planar faces.
+		* \param io_measurements The measurements to compute. The result of each measurement is written back into it.
+		* \param in_worker_count The number of threads used for the distance computations. 0 uses one thread per hardware thread.
+		* \return The number of measurements which were computed successfully. */
+		size_t MeasureBatch(std::vector<BatchMeasurement> & io_measurements, size_t in_worker_count = 0);
+
 	private:
 		enum class EdgeType											//used to determine the type of edge measured when using the EdgeAndRadius measurement type
 		{
@@ -5984,6 +6010,82 @@ public:
 			ComponentPath	path;									//the ComponentPath to this surface
 		};
 
+		class TopologyCache											//flat lookup tables from B-rep keys to their Exchange topology. Built once per CADModel
+		{
+		public:
+			TopologyCache();
+
+			struct Face
+			{
+				Exchange::Component	component;						//the ExchangeTopoFace component
+				ShellKey			shell;							//the shell representing this face
+				bool				surface_computed;				//whether surface_type, center and normal have been computed
+				Surface::SurfaceType surface_type;					//the simplified type of the underlying surface
+				Point				center;							//the center point of the surface, for cones and cylinders
+				Vector				normal;							//the center line of the surface, for cones and cylinders
+				bool				plane_normal_computed;			//whether plane_normal has been computed
+				Vector				plane_normal;					//the normal of planar faces, in the coordinate system of the shell
+			};
+
+			struct Edge
+			{
+				Exchange::Component	component;						//the ExchangeTopoEdge component
+				LineKey				line;							//the line representing this edge
+				size_t				coedge_count;					//the number of coedges owning this edge
+				size_t				faces[2];						//indices in the faces array of the faces owning the first two coedges
+				bool				length_computed;				//whether length, type, radius and circle_center have been computed
+				double				length;							//the length of the edge
+				EdgeType			type;							//the type of the edge
+				float				radius;							//the radius of the edge, if it is a circle
+				Point				circle_center;					//the center of the edge, if it is a circle
+			};
+
+			static const size_t		InvalidIndex = static_cast<size_t>(-1);
+
+			void Build(Exchange::CADModel const & in_cad_model);
+			void Reset();
+			bool IsBuiltFor(Exchange::CADModel const & in_cad_model) const;
+			size_t FindFace(Key const & in_shell_key) const;
+			size_t FindEdge(Key const & in_line_key) const;
+
+			std::vector<Face>	faces;
+			std::vector<Edge>	edges;
+
+		private:
+			Exchange::CADModel	model;								//the CADModel these tables were built from
+			std::unordered_map<Key, size_t, KeyHasher>	face_lookup;	//ShellKey to index in faces
+			std::unordered_map<Key, size_t, KeyHasher>	edge_lookup;	//LineKey to index in edges
+		};
+
+		class MeasurementRecord										//keys and parameters of a tagged measurement, used to restore it without searching its segment
+		{
+		public:
+			MeasurementRecord();
+
+			UTF8			measurement_type;						//the value of the MeasurementType tag, e.g. "point_to_point"
+			Vector			camera_direction;						//the camera direction the measurement was inserted with
+			MarkerKey		anchor_one;
+			MarkerKey		anchor_two;
+			MarkerKey		distance_marker_one;
+			MarkerKey		distance_marker_two;
+			MarkerKey		center_marker;							//the circle center for radius and angle measurements
+			LineKey			distance_line;
+			LineKey			leader_line_one;
+			LineKey			leader_line_two;
+			LineKey			line_to_cursor;
+			LineKey			line_to_leader_line;
+			LineKey			edge_line;
+			TextKey			text;
+			CircularArcKey	measurement_arc;
+			bool			has_explicit_direction;					//whether explicit_direction was tagged
+			Vector			explicit_direction;
+			float			radius;
+			bool			inverted;								//whether the angle measurement is inverted
+			Vector			mid_point_direction;
+			Vector			leader_line_one_direction;
+			Vector			leader_line_two_direction;
+		};
+
 		//bookkeeping
 		MeasurementType		measurement_type;						//the type of measurement to be inserted
 		MeasurementType		temporary_measurement_type;				//the type of the measurement to be edited
@@ -6089,6 +6191,11 @@ public:
 		void RestoreFeatureToFeatureMeasurement(SegmentKey const & measurement_segment);
 		void RestoreAngleMeasurement(SegmentKey const & measurement_segment);
 
+		//measurement index
+		std::unordered_map<Key, MeasurementRecord, KeyHasher> measurement_index;	//measurement segment to the record maintained by the Tag functions
+		MeasurementRecord & GetMeasurementRecord(SegmentKey const & measurement_segment);	//looks up a record, indexing the segment first if needed
+		void IndexMeasurement(SegmentKey const & measurement_segment, MeasurementRecord & out_record);	//fills a record by searching the segment, for measurements which were not tagged in this session
+
 		//topology functions
 		void GetEdgeLengthAndType(Exchange::Component const & edge_component);
 		void GetSurfaceType(Exchange::Component const & face_component, Surface & surface);
@@ -6100,6 +6207,16 @@ public:
 		float ClosestPointSegmentSegment(Point const & p1, Point const & q1, Point const & p2, Point const & q2, Point & c1, Point & c2);
 		bool IsPlane(Exchange::Component const & face_component);
 		Point GetPlaneIntersection(Plane const & in_plane, KeyPath const & in_key_path, WindowPoint const & in_window_point);
+		float TriangleDistanceSquared(PointArray const & in_points_one, IntArray const & in_facelist_one, PointArray const & in_points_two, IntArray const & in_facelist_two, Point & out_point_one, Point & out_point_two);
+		void GetCenterLine(Surface & io_surface, KeyPath const & in_path, Point & out_point_one, Point & out_point_two);
+
+		//topology cache
+		TopologyCache		topology;								//B-rep lookups shared by all measurement types
+		TopologyCache &		GetTopology();							//returns the topology cache, building it first if cad_model changed
+		void GetCachedEdgeLengthAndType(size_t in_edge_index);		//same as GetEdgeLengthAndType, computed once per edge
+		void GetCachedSurfaceType(size_t in_face_index, Surface & out_surface);	//same as GetSurfaceType, computed once per face
+		bool IsCachedPlane(size_t in_face_index);					//same as IsPlane, computed once per face
+		Vector GetCachedPlaneNormal(size_t in_face_index);			//the normal of a planar face in shell space, computed once per face
 	};
 
 private:
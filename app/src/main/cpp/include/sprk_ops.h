@@ -11,8 +11,12 @@
 #define SPRK_STD_OPERATORS_H
 #include "sprk.h"
 
+#include <atomic>
+#include <functional>
 #include <list>
+#include <memory>
 #include <stack>
+#include <thread>
 #include <unordered_map>
 #include <set>
 
@@ -54,6 +58,430 @@ namespace std
 namespace HPS
 {
 
+/*! The BoundingCache class keeps the bounding volume of the segments the navigation operators measure the scene with,
+ *  usually the segment of the attached Model. Operators ask for the size of the scene at the start of most gestures, and
+ *  asking Visualize for the bounding of a large model which was just edited forces a full recompute each time.
+ *  Operators which edit a model invalidate its entry. Applications which edit a model directly should call Invalidate. */
+class SPRK_OPS_API BoundingCache
+{
+public:
+	/*! Shows the bounding volume of a segment and everything below it, computing it only if it is not cached.
+	 * \param in_segment The segment whose bounding should be shown.
+	 * \param out_sphere The bounding sphere of the segment.
+	 * \param out_cuboid The bounding cuboid of the segment.
+	 * \return <span class='code'>true</span> if the segment has a valid bounding, <span class='code'>false</span> otherwise. */
+	static bool				ShowVolume(HPS::SegmentKey const & in_segment, HPS::SimpleSphere & out_sphere, HPS::SimpleCuboid & out_cuboid);
+
+	/*! Shows the bounding volume of the model attached to a view, or of the view segment if no model is attached.
+	 * \param in_view The view whose scene bounding should be shown.
+	 * \param out_sphere The bounding sphere of the scene.
+	 * \param out_cuboid The bounding cuboid of the scene.
+	 * \return <span class='code'>true</span> if the scene has a valid bounding, <span class='code'>false</span> otherwise. */
+	static bool				ShowVolume(HPS::View const & in_view, HPS::SimpleSphere & out_sphere, HPS::SimpleCuboid & out_cuboid);
+
+	/*! Discards the cached bounding of a segment. Call this after the contents of the segment have been edited. */
+	static void				Invalidate(HPS::SegmentKey const & in_segment);
+
+	/*! Discards the cached bounding of a model. Call this after the model has been edited. */
+	static void				Invalidate(HPS::Model const & in_model);
+
+	/*! Discards all cached boundings.
+	 * \return The number of boundings which were discarded. */
+	static size_t			InvalidateAll();
+};
+
+/*! The SelectionCache class remembers the results of recent point selections on each window, so that operators
+ *  reacting to the same tap do not each perform the same selection.
+ *  A cached result is reused only if the camera of the view, the attached model, the selection options and the
+ *  selection point (quantized to a fraction of a pixel) all match. Changing the camera therefore implicitly discards
+ *  the cached results. Edits to the model must be reported through Invalidate. */
+class SPRK_OPS_API SelectionCache
+{
+public:
+	/*! Selects by point on a window, reusing a previous result if one is available.
+	 * \param in_view The view whose camera the selection depends on.
+	 * \param in_window The window on which to perform the selection.
+	 * \param in_location The selection point, in window coordinates.
+	 * \param in_options The options used to perform the selection.
+	 * \param out_results The selection results. These are a copy of the cached results and can be modified freely.
+	 * \return The number of selected items. */
+	static size_t			SelectByPoint(HPS::View const & in_view, HPS::WindowKey const & in_window, HPS::Point const & in_location,
+										  HPS::SelectionOptionsKit const & in_options, HPS::SelectionResults & out_results);
+
+	/*! Discards the cached selections of a window. */
+	static void				Invalidate(HPS::WindowKey const & in_window);
+
+	/*! Discards the cached selections performed on a model. Call this after the model has been edited. */
+	static void				Invalidate(HPS::Model const & in_model);
+
+	/*! Discards the cached selections performed through a view. Call this after editing geometry or attributes which belong
+	 *  to the view rather than to the model, such as annotations or cutting sections. */
+	static void				Invalidate(HPS::View const & in_view);
+
+	/*! Discards all cached selections.
+	 * \return The number of selections which were discarded. */
+	static size_t			InvalidateAll();
+};
+
+/*! The PickingIndex class keeps a bounding volume hierarchy over the triangles of the shells of a model, which allows
+ *  analytic picking by ray, point and area without going through the selection code of the database.
+ *  Indices are built per model, either synchronously with Build or on a background thread with BuildAsync.
+ *  Until the index of a model is ready, the picking functions return no results, so callers are expected to fall
+ *  back to regular selection. Only shells are indexed. The index does not see later edits: call Invalidate when the model changes,
+ *  and it is built again when next picked.
+ *  Key paths in the results go from the shell to the model segment, in the same order as HPS::KeyPath. To obtain a
+ *  path to the window, append the include link and the model override segment of the view, followed by the event path. */
+class SPRK_OPS_API PickingIndex
+{
+public:
+	/*! The equivalent of a HPS::SelectionItem for a pick done through the index. */
+	struct Hit
+	{
+		HPS::KeyPath		path;			//!< Path from the shell to the model segment.
+		HPS::ShellKey		shell;			//!< The shell which was hit.
+		size_t				face;			//!< Index of the face of the shell which was hit.
+		HPS::Point			position;		//!< World space position of the hit.
+		float				distance;		//!< Distance along the ray, in world units. Zero for area picks.
+	};
+	typedef std::vector<Hit> HitArray;
+
+	/*! Builds the index of a model on a background thread. Any build in progress is cancelled.
+	 * \param in_model The model to index. */
+	static void				BuildAsync(HPS::Model const & in_model);
+
+	/*! Builds the index of a model on the calling thread.
+	 * \param in_model The model to index.
+	 * \return <span class='code'>true</span> if the model contains shells which could be indexed, <span class='code'>false</span> otherwise. */
+	static bool				Build(HPS::Model const & in_model);
+
+	/*! Whether the index of a model has finished building.
+	 * \param in_model The model to check.
+	 * \return <span class='code'>true</span> if picks can be performed on the model, <span class='code'>false</span> otherwise. */
+	static bool				IsReady(HPS::Model const & in_model);
+
+	/*! Discards the index of a model, cancelling its build if it is in progress. Call this after the model has been edited.
+	 *  The index is built again in the background by the next pick on the model, which falls back to selection meanwhile. */
+	static void				Invalidate(HPS::Model const & in_model);
+
+	/*! Invalidates the indices of all models, to release their memory until they are picked again. */
+	static void				InvalidateAll();
+
+	/*! Discards the index of a model for good, cancelling its build if it is in progress. Call this before deleting the model. */
+	static void				Remove(HPS::Model const & in_model);
+
+	/*! Cancels all builds in progress and discards all indices. Call this before shutting down the database. */
+	static void				Shutdown();
+
+	/*! Whether picks through the index agree with what a view draws. The index sees every shell of the model, so it
+	 *  doesn't once the view has cutting sections or the model has segments whose faces are hidden. Callers should
+	 *  fall back to regular selection then.
+	 * \param in_view The view to check.
+	 * \return <span class='code'>true</span> if the index can be picked in place of the view, <span class='code'>false</span> otherwise. */
+	static bool				MatchesView(HPS::View const & in_view);
+
+	/*! Shows the memory held by the indices which are ready.
+	 * \return The approximate number of bytes used by the indices. */
+	static size_t			GetMemoryUsage();
+
+	/*! Finds the closest triangle along a ray.
+	 * \param in_model The model to pick.
+	 * \param in_origin The origin of the ray, in world space.
+	 * \param in_direction The direction of the ray, in world space.
+	 * \param out_hit The closest hit along the ray.
+	 * \return <span class='code'>true</span> if something was hit, <span class='code'>false</span> otherwise. */
+	static bool				PickByRay(HPS::Model const & in_model, HPS::Point const & in_origin, HPS::Vector const & in_direction, Hit & out_hit);
+
+	/*! Finds the closest triangle under a window point.
+	 * \param in_model The model to pick.
+	 * \param in_event_path The event path of the window, as provided by input events.
+	 * \param in_window_point The pick location, in window coordinates.
+	 * \param out_hit The closest hit under the point.
+	 * \return <span class='code'>true</span> if something was hit, <span class='code'>false</span> otherwise. */
+	static bool				PickByPoint(HPS::Model const & in_model, HPS::KeyPath const & in_event_path, HPS::Point const & in_window_point, Hit & out_hit);
+
+	/*! Finds all shells which have at least one triangle in a window area. Hidden shells are found as well.
+	 *  Triangles which cross the camera plane are ignored.
+	 * \param in_model The model to pick.
+	 * \param in_event_path The event path of the window, as provided by input events.
+	 * \param in_area The pick area, in window coordinates.
+	 * \param out_hits One hit for each instance of a shell in the area.
+	 * \param in_worker_count The number of threads to test triangles with. Zero uses one thread per core.
+	 * \return The number of hits. */
+	static size_t			PickByArea(HPS::Model const & in_model, HPS::KeyPath const & in_event_path, HPS::Rectangle const & in_area, HitArray & out_hits, size_t in_worker_count = 0);
+};
+
+/*! The MeshDecimator class reduces triangle meshes with quadric error metric edge collapses. Vertices sharing a position
+ *  are welded before decimating, and open borders are kept in place. Polygons are triangulated and holes are ignored. */
+class SPRK_OPS_API MeshDecimator
+{
+public:
+	/*! One reduced version of a mesh. */
+	struct Level
+	{
+		HPS::PointArray		points;			//!< Points of the reduced mesh.
+		HPS::IntArray		facelist;		//!< Facelist of the reduced mesh, made of triangles only.
+	};
+	typedef std::vector<Level> LevelArray;
+
+	/*! Reduces a mesh to several levels of detail in a single pass, each level continuing from the previous one.
+	 *  The function only works on the arrays it is given and can be called from any thread.
+	 * \param in_points The points of the mesh.
+	 * \param in_facelist The facelist of the mesh, as used by HPS::ShellKit.
+	 * \param in_ratios The triangle count of each level, as a decreasing fraction of the triangle count of the mesh.
+	 *		A level stops short of its ratio if no more edges can be collapsed without folding the mesh.
+	 * \param out_levels One level for each ratio.
+	 * \param in_cancel If not null, the decimation stops as soon as this flag is raised.
+	 * \return <span class='code'>true</span> if the levels were produced, <span class='code'>false</span> if the mesh has no triangles or the decimation was cancelled. */
+	static bool				Decimate(HPS::PointArray const & in_points, HPS::IntArray const & in_facelist, HPS::FloatArray const & in_ratios,
+									 LevelArray & out_levels, std::atomic<bool> const * in_cancel = nullptr);
+};
+
+/*! The InteractionLOD class lets the navigation operators draw a lighter version of a model while the camera is moving.
+ *  Generate builds the proxies of a model once, usually right after import. Segments with many triangles get a subsegment
+ *  holding several decimated levels of their shells, built by MeshDecimator on all cores. Segments which are small
+ *  compared to the model get a bounding box instead. Conditional named styles defined in the portfolio of the model hide
+ *  the original geometry and show one level of the proxies whenever the interaction condition is set on the view. The
+ *  level shown is the most detailed one which fits in the triangle budget.
+ *  Navigation operators call BeginInteraction on every camera move, and Tick on every timer tick. Full detail is
+ *  restored once no move has been reported for the idle delay. Proxies do not follow later edits: call Remove before
+ *  editing or deleting a model which has them. */
+class SPRK_OPS_API InteractionLOD
+{
+public:
+	/*! Builds the proxies of a model. Any proxies previously generated for the model are replaced.
+	 * \param in_model The model to generate proxies for.
+	 * \param in_minimum_triangle_count Models with fewer triangles than this are cheap enough to draw at full detail and get no proxies.
+	 * \return <span class='code'>true</span> if proxies were generated, <span class='code'>false</span> otherwise. */
+	static bool				Generate(HPS::Model const & in_model, size_t in_minimum_triangle_count = 500000);
+
+	/*! Builds the proxies of a model on a background thread. Any build in progress is cancelled. The model switches to its
+	 *  proxies during interaction only once they are all ready, which IsAvailable reports.
+	 * \param in_model The model to generate proxies for.
+	 * \param in_minimum_triangle_count Models with fewer triangles than this are cheap enough to draw at full detail and get no proxies. */
+	static void				GenerateAsync(HPS::Model const & in_model, size_t in_minimum_triangle_count = 500000);
+
+	/*! Deletes the proxies of a model and the styles which switch to them, cancelling their build if it is in progress. */
+	static void				Remove(HPS::Model const & in_model);
+
+	/*! Cancels all builds in progress and forgets all proxies. Call this before shutting down the database. */
+	static void				Shutdown();
+
+	/*! Deletes the proxies of every model to save memory, cancelling any build in progress. The proxies of a model are
+	 *  generated again in the background the next time BeginInteraction is called for it, and it navigates at full detail meanwhile.
+	 * \return The number of proxy segments which were deleted. */
+	static size_t			ReleaseAll();
+
+	/*! Whether a model has proxies to switch to during interaction.
+	 * \param in_model The model to check.
+	 * \return <span class='code'>true</span> if the model has proxies, <span class='code'>false</span> otherwise. */
+	static bool				IsAvailable(HPS::Model const & in_model);
+
+	/*! Whether a segment holds proxies rather than original geometry. Code which walks the model segment tree should skip these.
+	 * \param in_segment The segment to check.
+	 * \return <span class='code'>true</span> if the segment holds proxies, <span class='code'>false</span> otherwise. */
+	static bool				IsProxySegment(HPS::SegmentKey const & in_segment);
+
+	/*! Switches the model attached to a view to its proxies, if it has any, and restarts the idle delay.
+	 *  Navigation operators should call this before updating the view after moving the camera.
+	 * \param in_view The view whose camera is moving. */
+	static void				BeginInteraction(HPS::View const & in_view);
+
+	/*! Switches the model attached to a view back to full detail immediately. */
+	static void				EndInteraction(HPS::View const & in_view);
+
+	/*! Switches the model attached to a view back to full detail if no interaction was reported for the idle delay.
+	 * \param in_view The view to check.
+	 * \return <span class='code'>true</span> if full detail was restored and the view needs an update, <span class='code'>false</span> otherwise. */
+	static bool				Tick(HPS::View const & in_view);
+
+	/*! Sets how long the camera must stay still before full detail is restored. Defaults to 0.3 seconds.
+	 * \param in_seconds The idle delay, in seconds. */
+	static void				SetIdleDelay(float in_seconds);
+
+	/*! Shows how long the camera must stay still before full detail is restored.
+	 * \return The idle delay, in seconds. */
+	static float			GetIdleDelay();
+
+	/*! Sets how many triangles the proxies of a model should have while interacting. Proxies generated afterwards pick
+	 *  the most detailed level which fits, or the least detailed one if none does. Defaults to one million.
+	 * \param in_triangle_count The triangle budget. */
+	static void				SetTriangleBudget(size_t in_triangle_count);
+
+	/*! Shows how many triangles the proxies of a model should have while interacting.
+	 * \return The triangle budget. */
+	static size_t			GetTriangleBudget();
+};
+
+/*! The MemoryBudget class keeps the geometry of a model within a memory budget by unloading the shells of the segments
+ *  which matter least for the current view, and loading them back when they are needed again.
+ *  The memory used by a segment is estimated from the vertex and index data of its shells. After the camera of a tracked
+ *  view settles, every tracked segment is tested against the view frustum. While over budget, hidden segments are unloaded
+ *  first, the least recently visible first, followed by the visible segments which cover the smallest part of the view.
+ *  Unloaded shells are written to an HSF file in the spill directory and replaced by a bounding box. Visible segments are
+ *  loaded back, largest first, while there is room for them. Without a spill directory, segments are only tracked.
+ *  The spill files of a settled camera are written and read on a worker thread, and the view is updated once it is done.
+ *  Unloading deletes the shells, so the keys of unloaded shells become invalid, and the picking index of the model is discarded.
+ *  Models whose keys are mapped elsewhere, like the components of an Exchange CADModel, should not be tracked. */
+class SPRK_OPS_API MemoryBudget
+{
+public:
+	/*! Starts tracking the segments of the model attached to a view. Any previous tracking of the model is discarded.
+	 * \param in_view The view whose camera decides which segments are needed.
+	 * \return <span class='code'>true</span> if the model has shells to track, <span class='code'>false</span> otherwise. */
+	static bool				Track(HPS::View const & in_view);
+
+	/*! Stops tracking a model and deletes its spill files. Shells which are unloaded at that point are not loaded back.
+	 *  Call this before deleting a tracked model. */
+	static void				Untrack(HPS::Model const & in_model);
+
+	/*! Applies the budget to the model attached to a view immediately, rather than waiting for the camera to settle.
+	 *  The spill files are written and read on the calling thread.
+	 * \param in_view The tracked view.
+	 * \return <span class='code'>true</span> if segments were unloaded or loaded and the view needs an update, <span class='code'>false</span> otherwise. */
+	static bool				Apply(HPS::View const & in_view);
+
+	/*! Unloads every segment of the tracked models which was outside of the view frustum at the last check, whatever the
+	 *  budget. The spill files are written on the worker thread, after any jobs already in flight, and the segments are
+	 *  loaded back once the camera settles with them in view.
+	 * \return The estimated number of bytes which are being unloaded. */
+	static size_t			UnloadHidden();
+
+	/*! Stops tracking all models and stops listening to timer ticks. Call this before shutting down the database. */
+	static void				Shutdown();
+
+	/*! Sets the number of bytes the geometry of each tracked model may use. Defaults to 256 MB.
+	 * \param in_bytes The memory budget, in bytes. */
+	static void				SetBudget(size_t in_bytes);
+
+	/*! Shows the number of bytes the geometry of each tracked model may use.
+	 * \return The memory budget, in bytes. */
+	static size_t			GetBudget();
+
+	/*! Sets the directory in which unloaded shells are written. Segments are never unloaded while this is empty.
+	 * \param in_directory The spill directory, which must exist and be writable. */
+	static void				SetSpillDirectory(char const * in_directory);
+
+	/*! Shows the estimated number of bytes used by the loaded geometry of a tracked model.
+	 * \param in_model The tracked model.
+	 * \return The estimated resident bytes, or zero if the model is not tracked. */
+	static size_t			GetResidentBytes(HPS::Model const & in_model);
+
+	/*! Loads back every unloaded segment of a tracked model on the calling thread, once the jobs in flight are done, and
+	 *  keeps the model loaded, whatever the budget, until Resume is called. Code which saves a model calls this first,
+	 *  since unloaded shells are only represented by a box in the database.
+	 * \param in_model The tracked model.
+	 * \return <span class='code'>true</span> if all of the model is loaded, <span class='code'>false</span> if a spill file could not be read. */
+	static bool				LoadAll(HPS::Model const & in_model);
+
+	/*! Lets the budget apply again to a model which LoadAll kept loaded. Segments are unloaded on the next tick if the model is over budget.
+	 * \param in_model The tracked model. */
+	static void				Resume(HPS::Model const & in_model);
+
+	/*! Shows the estimated number of bytes of geometry of a tracked model which are currently unloaded.
+	 * \param in_model The tracked model.
+	 * \return The estimated unloaded bytes, or zero if the model is not tracked. */
+	static size_t			GetUnloadedBytes(HPS::Model const & in_model);
+
+	/*! Whether a segment holds the box standing in for unloaded shells. Code which walks the model segment tree should skip these.
+	 * \param in_segment The segment to check.
+	 * \return <span class='code'>true</span> if the segment holds a box, <span class='code'>false</span> otherwise. */
+	static bool				IsProxySegment(HPS::SegmentKey const & in_segment);
+};
+
+/*! The OffscreenCapture class renders a view into an image file on a background thread, so that the window showing the
+ *  view keeps responding while it works. The view segment is copied under an offscreen window, which shares the model of
+ *  the view but has its own camera. Images larger than the largest offscreen surface are rendered in tiles, each with an
+ *  off-axis camera, and assembled before being encoded. Only one capture runs at a time. */
+class SPRK_OPS_API OffscreenCapture
+{
+public:
+	/*! Called on the capture thread once the capture is over.
+	 *  The first argument tells whether the image was written, and the second one is the requested file name. */
+	typedef std::function<void(bool, HPS::UTF8 const &)> Callback;
+
+	/*! Starts capturing a view. The camera of the view at the time of the call is used, widened to the aspect ratio of the image.
+	 * \param in_view The view to capture.
+	 * \param in_file_name The image file to write.
+	 * \param in_width The width of the image, in pixels.
+	 * \param in_height The height of the image, in pixels.
+	 * \param in_format The format of the image file. Png and Jpeg are the formats meant for this.
+	 * \param in_callback Function called on the capture thread once the file is written or the capture failed. It may be empty.
+	 * \param in_driver The driver of the offscreen window.
+	 * \return <span class='code'>true</span> if the capture was started, <span class='code'>false</span> if another capture is in progress or the arguments are invalid. */
+	static bool				Start(HPS::View const & in_view, char const * in_file_name, unsigned int in_width, unsigned int in_height, HPS::Image::Format in_format,
+								  Callback const & in_callback, HPS::Window::Driver in_driver = HPS::Window::Driver::Default3D);
+
+	/*! Whether a capture is in progress.
+	 * \return <span class='code'>true</span> if a capture is in progress, <span class='code'>false</span> otherwise. */
+	static bool				IsBusy();
+
+	/*! Stops the capture in progress after the tile being rendered, which releases its window and pixels. Its callback is
+	 *  called with <span class='code'>false</span>, and no file is written.
+	 * \return <span class='code'>true</span> if a capture was in progress, <span class='code'>false</span> otherwise. */
+	static bool				Cancel();
+
+	/*! Waits for the capture in progress to finish. Call this before shutting down the database. */
+	static void				Shutdown();
+
+	/*! Sets the largest width and height of the offscreen window. Larger images are rendered in tiles of this size. Defaults to 2048,
+	 *  which every OpenGL ES device in use supports.
+	 * \param in_size The largest size of a tile, in pixels. */
+	static void				SetMaxTileSize(unsigned int in_size);
+};
+
+/*! The SceneOptimizer class reorganizes a freshly imported model to be drawn with fewer draw calls. Segments which are
+ *  included only once are moved under their include. Shells repeated with only a rigid transform between them, such as the
+ *  fasteners of an assembly, are replaced by includes of a single copy. Then the model is regrouped by attributes and the
+ *  shells of each group are merged, with their modelling matrices folded into their points. Segments included several
+ *  times are left alone, so that instanced parts stay shared. Shells are only merged within a part, a named segment or a
+ *  segment mapped elsewhere, so that selecting a merged shell still selects the segment of its part.
+ *  Optimize the model before building anything else over its shells, such as a PickingIndex or interaction proxies. */
+class SPRK_OPS_API SceneOptimizer
+{
+public:
+	/*! The steps of the optimization which are applied. */
+	struct Options
+	{
+		Options() : flatten_includes(true), instance_shells(true), min_instance_vertices(32), min_instance_count(2), merge_shells(true) {}
+
+		bool				flatten_includes;		//!< Moves segments included only once under their include.
+		bool				instance_shells;		//!< Replaces repeated shells by includes of a single copy.
+		size_t				min_instance_vertices;	//!< Smaller shells are left to be merged, which saves more draw calls than instancing them.
+		size_t				min_instance_count;		//!< Shells repeated fewer times are left to be merged.
+		bool				merge_shells;			//!< Regroups each part of the model, a named segment, by attributes and merges the shells of each group.
+		HPS::KeyArray		mapped_keys;			//!< Keys mapped elsewhere, like those of the components of an Exchange CADModel. Mapped segments are parts
+													//!< whose keys are kept, and the shells of a segment holding a mapped shell are not merged. Flattening
+													//!< and instancing move segments and shells regardless, turn them off when keys are mapped.
+	};
+
+	/*! The size of the model before and after the optimization. Segments and shells reached through several includes are counted once. */
+	struct Statistics
+	{
+		Statistics() : segments_before(0), segments_after(0), shells_before(0), shells_after(0), includes_flattened(0), shells_instanced(0), prototypes(0) {}
+
+		size_t				segments_before;
+		size_t				segments_after;
+		size_t				shells_before;
+		size_t				shells_after;
+		size_t				includes_flattened;
+		size_t				shells_instanced;		//!< Shells replaced by an include of a prototype.
+		size_t				prototypes;				//!< Shells which are included in place of the repeated ones.
+	};
+
+	/*! Optimizes a model. Prototypes from a previous optimization of the model are kept.
+	 * \param in_model The model to optimize.
+	 * \param in_options The steps to apply.
+	 * \param out_statistics The size of the model before and after the optimization.
+	 * \return <span class='code'>true</span> if the model was optimized, <span class='code'>false</span> if it is invalid. */
+	static bool				Optimize(HPS::Model const & in_model, Options const & in_options, Statistics & out_statistics);
+
+	/*! Deletes the prototypes of the instanced shells of a model. Call this before deleting the model. */
+	static void				Forget(HPS::Model const & in_model);
+
+	/*! Forgets the prototypes of all models. Call this before shutting down the database. */
+	static void				Shutdown();
+};
+
 /*! The PanOrbitZoomOperator class defines an operator which allows the user to pan, orbit and zoom the camera.
  *  This Operator works for both mouse- and touch-driven devices. 
  *  Mouse-Driven Devices:
@@ -104,6 +532,15 @@ public:
 	 * \return <span class='code'>true</span> if the input event was handled, <span class='code'>false</span> otherwise. */
 	virtual bool			OnTouchMove(TouchState const & in_state);
 
+	/*! This function is called whenever HPS receives a TimerTickEvent
+	 *  This function restores the full detail of the model once the camera stopped moving. See InteractionLOD.
+	 * \param in_event A TimerTickEvent object describing the current timer tick.
+	 * \return <span class='code'>true</span> if the input event was handled, <span class='code'>false</span> otherwise. */
+	virtual bool			OnTimerTick(HPS::TimerTickEvent const & in_event);
+
+	/*! This function is called whenever a view is detached from this operator. */
+	virtual void			OnViewDetached(HPS::View const & in_detached_view);
+
 private:
 	HPS::WorldPoint			start;
 
@@ -227,6 +664,15 @@ public:
 	 * \return <span class='code'>true</span> if the input event was handled, <span class='code'>false</span> otherwise. */
 	virtual bool			OnTouchMove(TouchState const & in_state);
 
+	/*! This function is called whenever HPS receives a TimerTickEvent
+	 *  This function restores the full detail of the model once the camera stopped moving. See InteractionLOD.
+	 * \param in_event A TimerTickEvent object describing the current timer tick.
+	 * \return <span class='code'>true</span> if the input event was handled, <span class='code'>false</span> otherwise. */
+	virtual bool			OnTimerTick(HPS::TimerTickEvent const & in_event);
+
+	/*! This function is called whenever a view is detached from this operator. */
+	virtual void			OnViewDetached(HPS::View const & in_detached_view);
+
 private:
 	bool					OrbitCommon(HPS::WindowPoint const & in_loc);
 
@@ -421,19 +867,53 @@ public:
 	*/
 	SelectAreaOperator(MouseButtons in_mouse_trigger = MouseButtons::ButtonLeft(), ModifierKeys in_modifier_trigger = ModifierKeys());
 
+	virtual ~SelectAreaOperator();
+
 	virtual HPS::UTF8				GetName() const	{ return "HPS_SelectAreaOperator"; }
 
 	virtual void					OnViewAttached(HPS::View const & in_attached_view);
+	virtual void					OnViewDetached(HPS::View const & in_detached_view);
 
+	virtual bool					OnMouseDown(MouseState const & in_state);
 	virtual bool					OnMouseUp(MouseState const & in_state);
+	virtual bool					OnTouchDown(TouchState const & in_state);
 	virtual bool					OnTouchUp(TouchState const & in_state);
+	virtual bool					OnTimerTick(HPS::TimerTickEvent const & in_event);
 
 	/*!
 		This method returns the results of the last selection action. If no objects were selected,
 		the SelectionResults object returned will be have a count of 0.
+		While a streamed selection is in progress, only the batches received so far are part of the results.
 	*/
 	HPS::SelectionResults			GetActiveSelection() const;
 
+	/*!
+		Sets whether area selections are streamed. When streaming, the model is split into subtrees which are
+		selected on worker threads, and the results are merged into the active selection in batches on timer ticks,
+		so that the UI does not stall on large models. Starting a new gesture cancels a streamed selection in progress.
+		When the selection options have a scope, or no model is attached, the selection is done in one piece on a worker thread.
+		Otherwise only the attached model is selected.
+		When not streaming, the whole area is selected synchronously when the rectangle is completed. Defaults to true.
+
+		\param in_streaming Whether area selections should be streamed.
+	*/
+	void							SetStreaming(bool in_streaming) { streaming = in_streaming; }
+
+	/*!
+		Gets whether area selections are streamed.
+	*/
+	bool							GetStreaming() const { return streaming; }
+
+	/*!
+		Whether a streamed selection is still in progress.
+	*/
+	bool							IsSelecting() const;
+
+	/*!
+		Cancels a streamed selection in progress. The batches already received remain in the active selection.
+	*/
+	void							CancelSelection();
+
 	/*!
 		Sets the selection options that will be used as selection criteria for this operator.
 
@@ -446,11 +926,35 @@ public:
 	*/
 	HPS::SelectionOptionsKit		GetSelectionOptions() const { return selection_options; }
 
+protected:
+	/*!
+		Called on the thread which handles the events each time a batch of results is merged into the active selection.
+		When the selection is not streamed, this is called once with all the results.
+
+		\param in_window The window on which the selection is performed.
+		\param in_batch The results which have just been merged.
+	*/
+	virtual void					OnSelectionBatch(HPS::WindowKey const & in_window, HPS::SelectionResults const & in_batch);
+
+	/*!
+		Called before the results of a new area selection are merged into the active selection.
+
+		\param in_window The window on which the selection is performed.
+		\param in_modifiers The modifier keys which were active when the rectangle was completed.
+	*/
+	virtual void					OnSelectionStart(HPS::WindowKey const & in_window, HPS::ModifierKeys in_modifiers);
+
 private:
-	bool							SelectCommon(HPS::WindowKey & in_window, HPS::ModifierKeys in_modifiers = HPS::ModifierKeys());
+	struct StreamedSelection;
+
+	bool							SelectCommon(HPS::WindowKey & in_window, HPS::KeyArray const & in_event_path, HPS::ModifierKeys in_modifiers = HPS::ModifierKeys());
+	void							StartStreaming(HPS::WindowKey const & in_window, HPS::KeyArray const & in_event_path);
+	void							MergeBatch(HPS::WindowKey const & in_window, HPS::SelectionResults const & in_batch);
 
 	HPS::SelectionResults			active_selection;
 	HPS::SelectionOptionsKit		selection_options;
+	bool							streaming;
+	std::shared_ptr<StreamedSelection>	streamed_selection;
 };
 
 
@@ -484,9 +988,11 @@ public:
 	*/
 	HPS::HighlightOptionsKit		GetHighlightOptions() const { return highlight_options; }
 
-private:
-	bool							HighlightCommon(WindowKey & in_window, ModifierKeys in_modifiers);
+protected:
+	virtual void					OnSelectionStart(HPS::WindowKey const & in_window, HPS::ModifierKeys in_modifiers);
+	virtual void					OnSelectionBatch(HPS::WindowKey const & in_window, HPS::SelectionResults const & in_batch);
 
+private:
 	HPS::HighlightOptionsKit		highlight_options;
 
 };
@@ -566,7 +1072,7 @@ public:
 	/*! Accepts a HighlightOptionsKit that defines how an object will be highlighted. 
 	* \param in_options The HighlightOptionsKit from which the highlight options will be set 
 	*/
-	void							SetHighlightOptions(HPS::HighlightOptionsKit const & in_options) { highlight_options = in_options; }
+	void							SetHighlightOptions(HPS::HighlightOptionsKit const & in_options) { highlight_options = in_options; highlighted_valid = false; }
 
 	/*! Gets the HPS::HighlightOptionsKit associated with this operator.
 	* \return The HPS::HighlightOptionsKit associated with this operator 
@@ -575,8 +1081,12 @@ public:
 
 private:
 	bool							HighlightCommon(HPS::WindowKey & in_window, HPS::ModifierKeys in_modifiers);
+	void							HighlightAll(HPS::HighlightControl & in_highlight_control, HPS::SelectionResults const & in_results);
+	bool							HighlightsIntact(HPS::HighlightControl const & in_highlight_control) const;
 
 	HPS::HighlightOptionsKit		highlight_options;
+	HPS::SelectionResults			highlighted;			//items currently highlighted by this operator
+	bool							highlighted_valid;		//whether highlighted was made with the current highlight options
 };
 
 class SPRK_OPS_API MouseWheelOperator : public Operator
@@ -669,6 +1179,15 @@ public:
 	 * \return <span class='code'>true</span> if the input event was handled, <span class='code'>false</span> otherwise. */
 	virtual bool			OnTouchMove(TouchState const & in_state);
 
+	/*! This function is called whenever HPS receives a TimerTickEvent
+	 *  This function restores the full detail of the model once the camera stopped moving. See InteractionLOD.
+	 * \param in_event A TimerTickEvent object describing the current timer tick.
+	 * \return <span class='code'>true</span> if the input event was handled, <span class='code'>false</span> otherwise. */
+	virtual bool			OnTimerTick(HPS::TimerTickEvent const & in_event);
+
+	/*! This function is called whenever a view is detached from this operator. */
+	virtual void			OnViewDetached(HPS::View const & in_detached_view);
+
 private:
 	void					TurntableCommon(HPS::WindowPoint const & delta, HPS::Vector const & rotation_axis);
 	void					CalculateCenterPoint(HPS::WindowKey const & window, HPS::Point const & location);
@@ -968,6 +1487,8 @@ class SPRK_OPS_API WalkOperator : public FlyOperator
 public:
 	WalkOperator(MouseButtons in_mouse_trigger = MouseButtons::ButtonRight(), ModifierKeys in_modifier_trigger = ModifierKeys());
 
+	virtual ~WalkOperator();
+
 	/*! Returns the name of the operator. */
 	virtual HPS::UTF8		GetName() const	{ return "HPS_WalkOperator"; }
 
@@ -978,6 +1499,10 @@ public:
 	/*! This function is called whenever a view is attached to this operator. */
 	virtual void			OnViewAttached(HPS::View const & in_attached_view);
 
+	/*! This function is called whenever a view is detached from this operator.
+	 * \param in_detached_view The view that was detached. */
+	virtual void			OnViewDetached(HPS::View const & in_detached_view);
+
 	/*! This function is called whenever HPS receives a TimerTickEvent
 	 *  This function moves the camera
 	 * \param in_state A TimerTickEvent object describing the current timer tick.
@@ -1001,16 +1526,110 @@ public:
 
 	Axis					UpdatePrimaryUpAxis(HPS::Vector const & v);
 
+	/*! Enables or disables terrain following. When terrain following is on, the camera follows the floors of the model
+	 *  instead of the ground plane: each timer tick a ray is cast downwards against the shells of the model to find the floor
+	 *  under the walker, and movement is stopped or slid along walls the walker would walk through.
+	 *  The shells are gathered into a spatial index on a background thread the first time it is needed, and the walker moves
+	 *  freely until it is ready. The index is rebuilt when a new model is attached, and when the model is invalidated.
+	 * \param in_state Whether terrain following should be enabled. */
+	void					SetTerrainFollowing(bool in_state);
+
+	/*! Returns whether terrain following is enabled.
+	 * \return <span class='code'>true</span> if terrain following is enabled, <span class='code'>false</span> otherwise. */
+	bool					GetTerrainFollowing() const { return terrain_following; }
+
+	/* Getters / Setters for the tallest obstacle, such as a stair step, the walker can step over when terrain following is enabled.
+	 * A negative value means the step height is 35% of the walker height. */
+	void					SetStepHeight(float in_height) { step_height = in_height; }
+	float					GetStepHeight() const { return step_height; }
+
+	/*! Discards the spatial index used for terrain following. Call this after the geometry of the model has been edited.
+	 *  The index is rebuilt the next time the camera moves. */
+	void					InvalidateTerrain();
+
+	/*! Discards the spatial indices of every walk operator following the terrain of a model. Call this after the geometry
+	 *  of the model has been edited, from code which does not know the operators, the way PickingIndex::Invalidate is called.
+	 * \param in_model The edited model. */
+	static void				InvalidateTerrain(HPS::Model const & in_model);
+
 private:
+	/* A uniform grid over the ground plane, holding the world space triangles of the model's shells.
+	 * Each cell references the triangles whose projection onto the ground plane overlaps it. */
+	class TerrainIndex
+	{
+	public:
+		TerrainIndex();
+
+		bool				Build(HPS::SegmentKey const & in_model_segment, HPS::Vector const & in_up, std::atomic<bool> const & in_cancel);
+		void				Reset();
+		bool				IsBuilt() const { return built; }
+		bool				IsBuiltFor(HPS::Vector const & in_up) const;
+
+		/* Casts a ray from in_origin against -up, returning the closest hit within in_max_distance. */
+		bool				CastDown(HPS::Point const & in_origin, float in_max_distance, HPS::Point & out_hit) const;
+
+		/* Intersects the segment between in_start and in_end with the triangles, returning the closest hit
+		 * as a parameter along the segment, together with the normal of the triangle which was hit. */
+		bool				IntersectSegment(HPS::Point const & in_start, HPS::Point const & in_end, float & out_parameter, HPS::Vector & out_normal) const;
+
+	private:
+		struct Triangle
+		{
+			HPS::Point		origin;
+			HPS::Vector		edge_one;
+			HPS::Vector		edge_two;
+			HPS::Vector		normal;
+		};
+
+		bool				Collect(HPS::SegmentKey const & in_segment, HPS::MatrixKit const & in_parent_matrix, std::atomic<bool> const & in_cancel);
+		void				AddShell(HPS::ShellKey const & in_shell, HPS::MatrixKit const & in_matrix);
+		bool				IntersectTriangle(Triangle const & in_triangle, HPS::Point const & in_origin, HPS::Vector const & in_direction, float & out_parameter) const;
+		void				GetCell(HPS::Point const & in_point, int & out_column, int & out_row) const;
+
+		bool				built;
+		HPS::Vector			up;
+		HPS::Vector			axis_u;
+		HPS::Vector			axis_v;
+		float				min_u;
+		float				min_v;
+		float				cell_size;
+		int					columns;
+		int					rows;
+		std::vector<Triangle>	triangles;
+		std::vector<std::vector<uint32_t>>	cells;
+	};
+
+	/* An index being built on a background thread, handed over to the operator on the first timer tick after it is done. */
+	struct TerrainBuild
+	{
+		TerrainBuild() : cancel(false), done(false), generation(0) {}
+
+		std::atomic<bool>		cancel;
+		std::atomic<bool>		done;
+		HPS::Vector				up;
+		uint64_t				generation;
+		TerrainIndex			index;
+	};
+
 	HPS::Plane				ground;
 	HPS::Vector				walking_direction;
 	float					height_off_ground;
 
 	Axis					primary_up_axis;
 
+	bool					terrain_following;
+	float					step_height;
+	TerrainIndex			terrain;
+	uint64_t				terrain_generation;		//invalidation count of the model when the terrain was built
+	std::shared_ptr<TerrainBuild>	terrain_build;
+	std::thread				terrain_builder;
+
 	void					CalculateGroundPlane();
 	void					SnapToPlane();
 	void					AdjustWalkingDirection(HPS::Vector const & camera_direction, HPS::Vector const & camera_up);
+	void					FollowTerrain(HPS::Point const & previous_position, HPS::Point & camera_position, HPS::Point & camera_target, bool snap_to_floor);
+	void					StartTerrainBuild(HPS::SegmentKey const & in_model_segment, HPS::Vector const & in_up, uint64_t in_generation);
+	void					CancelTerrainBuild();
 };
 
 /*! The SimpleWalkOperator class defines an operator which allows the user to move forward and backwards and rotate 
@@ -1557,6 +2176,12 @@ public:
 	 * \return <span class='code'>true</span> if the input event was handled, <span class='code'>false</span> otherwise. */
     virtual bool            OnTextInput(HPS::UTF8 const & in_text) override;
 
+	/*! This function is called whenever HPS receives a TimerTickEvent.
+	 *  While freehand markup is being drawn, this function adds the points collected since the last tick to the markup line.
+	 * \param in_event A TimerTickEvent object describing the current timer tick.
+	 * \return <span class='code'>true</span> if the input event was handled, <span class='code'>false</span> otherwise. */
+	virtual bool			OnTimerTick(HPS::TimerTickEvent const & in_event) override;
+
 	/*! Returns the type of markup the operator will insert. */
 	MarkupType				GetMarkupType() { return markup_type; }
 
@@ -1584,6 +2209,15 @@ public:
 	/*! Changes the color of the markup which will be inserted. */
 	void					SetLineAttribute(LineAttributeKit const & in_line_attributes) {current_attributes.line_attributes = in_line_attributes; }
 
+	/*! Returns the simplification tolerance of freehand markup, in pixels. */
+	float					GetFreehandTolerance() { return freehand_tolerance; }
+
+	/*! Changes the simplification tolerance of freehand markup.
+	 *  Input samples closer than this distance to the last point of the stroke are dropped, and points which lie within this distance
+	 *  of the line joining their neighbors are removed while the stroke is drawn. A tolerance of zero keeps every sample.
+	 * \param in_pixels The tolerance, in pixels. */
+	void					SetFreehandTolerance(float in_pixels) { freehand_tolerance = in_pixels; }
+
 	/*! Returns the top markup segment.
 	 * This segment will not be valid before the operator is attached to the view, and after it is detached from the view.
 	* \return The segment containing all the markups inserted by this operator */
@@ -1689,9 +2323,19 @@ private:
 	static const LineAttributeKit	default_line_attributes;
 
 	Point					start_point;
+	Point					start_pixel_point;
 	bool					start_new_line;
 	LineKey					current_line;
 	size_t					current_line_size;
+
+	float					freehand_tolerance;			//in pixels
+	PointArray				freehand_points;			//simplified points waiting to be added to current_line
+	Point					freehand_anchor;			//pixel position of the point before the last kept point
+	Point					freehand_last;				//pixel position of the last kept point
+	PointArray				freehand_skipped;			//pixel positions of the samples removed since freehand_anchor
+	bool					freehand_last_pending;		//whether the last kept point can still be replaced
+	Point					freehand_tail;				//the last sample, which is added when the stroke ends if it was dropped
+	bool					freehand_tail_dropped;
 	CircleKey				current_circle;
 	LineKey					current_circle_line;
 	LineKey					current_rectangle;
@@ -1716,7 +2360,9 @@ private:
 	bool					SetupConstructionSegments();
 	void					LookupSegment();
 	void					CreateNewMarkupSegment();
-	void					DrawFreehand(Point const & location);
+	void					StartFreehand();
+	bool					DrawFreehand(Point const & location, Point const & pixel_location);
+	bool					CommitFreehand(bool end_of_stroke);
 	void					DrawText();
 	void					DrawCircle(Point const & location);
     void                    DrawCircleFromTwoPoints(Point const & point_one, Point const & point_two);
@@ -2298,6 +2944,27 @@ private:
 	CircularArcKey			trailing_circle;
 	float					rotation_direction;
 
+	//drag state, computed when a handle is grabbed so that moving the handles does not query the database
+	FloatArray				window_to_world;			//Elements of the window to world matrix of the view, valid until the handle is released.
+	MatrixKit				handles_matrix;				//In-memory copy of the modelling matrix of handles_segment.
+	bool					reference_matrix_valid;		//Whether reference_segment has a modelling matrix.
+	MatrixKit				inverse_reference_matrix;	//Inverse of the modelling matrix of reference_segment.
+	Vector					reference_scale;			//Squared scale of inverse_reference_matrix along each axis.
+	MatrixKit				accumulated_transform;		//In-memory copy of the modelling matrix of temporary_segment_to_move.
+	bool					has_accumulated_transform;
+
+	//include analysis of segment_to_move, computed when the handles are inserted and used when the changes are committed
+	struct IncludeAnalysis
+	{
+		bool				multiple_includes;			//segment_to_move is reached through a chain of includes which all need to be broken
+		bool				included_along_path;		//segment_to_move is included into one of the segments along its path
+		size_t				includers;					//number of includes referencing segment_to_move
+		size_t				minimum_number_of_includes;
+		IncludeKeyArray		includes;
+		SegmentKeyArray		including_segments;			//owners of includes
+	};
+	IncludeAnalysis			include_analysis;
+
 	bool					InputDown(size_t in_click_count, WindowKey const & in_window, KeyArray const & in_event_path, Point const & in_location);
 	bool					InputMove(KeyPath const & in_path, Point const & in_location);
 	void					InputUp(Point const & in_location);
@@ -2312,6 +2979,9 @@ private:
 
 	//moves the geometry affected by handles into a new segment, and hides the original
 	void					ReferenceGeometry(KeyPath const & in_path);
+	void					AnalyzeIncludes();
+	Point					WindowToWorld(KeyPath const & in_path, Point const & in_window_point) const;
+	void					TranslateGeometry(Vector const & in_world_displacement);
 
 	//copies the accumulated transform from the reference geometry segment back into the original place.
 	//removes the hide highlight from the original geometry
@@ -166,7 +166,7 @@ bool HPS::AnnotationOperator::InputDown(HPS::WindowKey const & window, HPS::Poin
     
     //check if we have selected a previously inserted annotation
     SelectionResults results;
-    if (window.GetSelectionControl().SelectByPoint(location, annotation_selection_options, results) > 0)
+    if (SelectionCache::SelectByPoint(last_attached_view, window, location, annotation_selection_options, results) > 0)
     {
         SelectionResultsIterator it = results.GetIterator();
         Key selected_key;
@@ -196,7 +196,7 @@ bool HPS::AnnotationOperator::InputDown(HPS::WindowKey const & window, HPS::Poin
     //check to see if we have selected geometry
     //this time scope the selection to everything under the model segment to avoid selecting navigation aids
     selection_options.SetScope(scoped_path);
-    if (window.GetSelectionControl().SelectByPoint(location, selection_options, results) > 0)
+    if (SelectionCache::SelectByPoint(last_attached_view, window, location, selection_options, results) > 0)
     {
         SelectionResultsIterator it = results.GetIterator();
         Key selected_key;
@@ -412,6 +412,9 @@ void HPS::AnnotationOperator::AddAnnotationUserData()
 	data.push_back('\0');
 
 	text_to_edit.SetUserData(0, data);
+
+	//annotations can be selected, so previous selections on this view are no longer valid
+	SelectionCache::Invalidate(last_attached_view);
 }
 
 void HPS::AnnotationOperator::StartNewNote()
@@ -0,0 +1,95 @@
+// Copyright (c) Tech Soft 3D, Inc.
+//
+// The information contained herein is confidential and proprietary to Tech Soft 3D, Inc.,
+// and considered a trade secret as defined under civil and criminal statutes.
+// Tech Soft 3D, Inc. shall pursue its civil and criminal remedies in the event of
+// unauthorized use or misappropriation of its trade secrets.  Use of this information
+// by anyone other than authorized employees of Tech Soft 3D, Inc. is granted only under
+// a written non-disclosure agreement, expressly prescribing the scope and manner of such use.
+
+#include "sprk_ops.h"
+
+#include <mutex>
+
+using namespace HPS;
+
+namespace
+{
+	struct CachedBounding
+	{
+		bool				valid;
+		SimpleSphere		sphere;
+		SimpleCuboid		cuboid;
+	};
+
+	typedef std::unordered_map<Key, CachedBounding, KeyHasher> BoundingMap;
+
+	std::mutex & GetBoundingMutex()
+	{
+		static std::mutex bounding_mutex;
+		return bounding_mutex;
+	}
+
+	BoundingMap & GetBoundingMap()
+	{
+		static BoundingMap bounding_map;
+		return bounding_map;
+	}
+}
+
+bool HPS::BoundingCache::ShowVolume(HPS::SegmentKey const & in_segment, HPS::SimpleSphere & out_sphere, HPS::SimpleCuboid & out_cuboid)
+{
+	std::lock_guard<std::mutex> lock(GetBoundingMutex());
+	BoundingMap & bounding_map = GetBoundingMap();
+
+	auto it = bounding_map.find(in_segment);
+	if (it == bounding_map.end())
+	{
+		//drop the entries of segments which have been deleted since they were cached
+		for (auto entry = bounding_map.begin(); entry != bounding_map.end();)
+		{
+			if (entry->first.Type() == HPS::Type::None)
+				entry = bounding_map.erase(entry);
+			else
+				++entry;
+		}
+
+		CachedBounding cached;
+		BoundingKit bounding;
+		cached.valid = in_segment.ShowBounding(bounding) && bounding.ShowVolume(cached.sphere, cached.cuboid);
+		it = bounding_map.insert(std::make_pair(in_segment, cached)).first;
+	}
+
+	out_sphere = it->second.sphere;
+	out_cuboid = it->second.cuboid;
+	return it->second.valid;
+}
+
+bool HPS::BoundingCache::ShowVolume(HPS::View const & in_view, HPS::SimpleSphere & out_sphere, HPS::SimpleCuboid & out_cuboid)
+{
+	Model model = in_view.GetAttachedModel();
+	if (model.Type() != HPS::Type::None)
+		return ShowVolume(model.GetSegmentKey(), out_sphere, out_cuboid);
+	else
+		return ShowVolume(in_view.GetSegmentKey(), out_sphere, out_cuboid);
+}
+
+void HPS::BoundingCache::Invalidate(HPS::SegmentKey const & in_segment)
+{
+	std::lock_guard<std::mutex> lock(GetBoundingMutex());
+	GetBoundingMap().erase(in_segment);
+}
+
+void HPS::BoundingCache::Invalidate(HPS::Model const & in_model)
+{
+	if (in_model.Type() != HPS::Type::None)
+		Invalidate(in_model.GetSegmentKey());
+}
+
+size_t HPS::BoundingCache::InvalidateAll()
+{
+	std::lock_guard<std::mutex> lock(GetBoundingMutex());
+	size_t const count = GetBoundingMap().size();
+	GetBoundingMap().clear();
+	return count;
+}
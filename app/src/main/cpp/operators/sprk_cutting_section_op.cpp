@@ -105,6 +105,7 @@ bool HPS::CuttingSectionOperator::OnMouseUp(MouseState const & in_state)
 			if (visibility_control.ShowCutFaces(cut_geometry_visibility) && !cut_geometry_visibility)
 			{
 				visibility_control.SetCutGeometry(true);
+				SelectionCache::Invalidate(GetAttachedView());
 				op_state = OpState::Initialized;
 				indicator_seg.Flush(Search::Type::Geometry);
 				GetAttachedView().Update();
@@ -314,6 +315,7 @@ bool HPS::CuttingSectionOperator::OnTouchUp(TouchState const & in_state)
 					if (visibility_control.ShowCutFaces(cut_geometry_visibility) && !cut_geometry_visibility)
 					{
 						visibility_control.SetCutGeometry(true);
+						SelectionCache::Invalidate(GetAttachedView());
 						op_state = OpState::Initialized;
 						GetAttachedView().Update();
 					}
@@ -459,6 +461,8 @@ HPS::ShellKey HPS::CuttingSectionOperator::InsertCuttingPlaneGeometry()
 	facelist.push_back(2);
 	facelist.push_back(3);
 
+	//cutting planes change what can be selected in the view
+	SelectionCache::Invalidate(GetAttachedView());
 	return plane_representation_segment.Subsegment("").InsertShell(points, facelist);
 }
 
@@ -475,7 +479,7 @@ void HPS::CuttingSectionOperator::MouseOverHighlighting(HPS::MouseState const &
 		//highlight the cutting plane when we mouse over it
 		HPS::SelectionResults results;
 		plane_representation_segment.GetSelectabilityControl().SetFaces(HPS::Selectability::Value::On);
-		size_t count = in_state.GetEventSource().GetSelectionControl().SelectByPoint(in_state.GetLocation(), mouse_over_selection_options, results);
+		size_t count = SelectionCache::SelectByPoint(GetAttachedView(), event_source, in_state.GetLocation(), mouse_over_selection_options, results);
 		plane_representation_segment.GetSelectabilityControl().SetEverything(HPS::Selectability::Value::Off);
 
 		if (count > 0)
@@ -640,6 +644,7 @@ void HPS::CuttingSectionOperator::TranslateCuttingPlane(HPS::KeyPath const & in_
 		ViewAlignSectionPlanes(cutting_planes);
 
     translating_section.EditPlanesByReplacement(0, cutting_planes);
+    SelectionCache::Invalidate(GetAttachedView());
     
     start_world_point = current_point;
     GetAttachedView().Update();
@@ -817,6 +822,7 @@ void HPS::CuttingSectionOperator::SetPlaneVisibility(bool in_visibility)
 {
 	SetupOperatorSegment();
 	plane_representation_segment.GetVisibilityControl().SetFaces(in_visibility).SetEdges(in_visibility).SetPerimeterEdges(in_visibility);
+	SelectionCache::Invalidate(GetAttachedView());
 }
 
 bool HPS::CuttingSectionOperator::GetPlaneVisibility()
@@ -8,6 +8,7 @@
 // a written non-disclosure agreement, expressly prescribing the scope and manner of such use.
 
 #include "sprk_exchange.h"
+#include "sprk_ops.h"
 
 #if (defined(_MSC_VER) && _MSC_VER >= 1900)
 #	pragma warning( push )
@@ -20,8 +21,10 @@
 #	pragma warning( pop )
 #endif
 
+#include <atomic>
 #include <sstream>
 #include <string>
+#include <thread>
 
 #if defined(TARGET_OS_ANDROID)
 #include <sstream>
@@ -168,6 +171,8 @@ void Exchange::MeasurementOperator::OnViewDetached(HPS::View const &)
 {
 	ResetMeasurement();
 	canvases.clear();
+	topology.Reset();
+	measurement_index.clear();
 }
 
 bool Exchange::MeasurementOperator::OnMouseDown(MouseState const & in_state)
@@ -466,12 +471,14 @@ bool Exchange::MeasurementOperator::InsertEdgeRadiusMeasurement(KeyPath const &
 
 	//this edge key should belong to a component of type exchange topological edge.
 	//if this is not the case if probably means the file was imported without b-rep, and there is nothing this operator can do.
-	HPS::Exchange::Component edge_component = cad_model.GetComponentPath(HPS::KeyPath(in_edge_key + in_selection_path)).Front();
-	if (edge_component.GetComponentType() != Component::ComponentType::ExchangeTopoEdge)
+	TopologyCache & topology_cache = GetTopology();
+	size_t edge_index = topology_cache.FindEdge(in_edge_key);
+	if (edge_index == TopologyCache::InvalidIndex)
 		return false;
+	TopologyCache::Edge const & cached_edge = topology_cache.edges[edge_index];
 
 	//calculate the length and type of the edge
-	GetEdgeLengthAndType(edge_component);
+	GetCachedEdgeLengthAndType(edge_index);
 
 	//get net modelling matrix from model segment to selection segment
 	KeyArray selection_keys;
@@ -496,17 +503,11 @@ bool Exchange::MeasurementOperator::InsertEdgeRadiusMeasurement(KeyPath const &
 	{
 		current_measurement = measurement_segment.Subsegment(CommonMeasurementOperator::GetNewMeasurementSegmentName("Length"));
 
-		auto get_face_normal = [&](HPS::Exchange::Component const & in_coedge, Vector & out_normal)
+		auto get_face_normal = [&](size_t in_face_index, Vector & out_normal)
 		{
-			auto loop = in_coedge.GetOwners();
-			auto face = loop[0].GetOwners();
-			HPS::Exchange::Component topo_face(face[0]);
-			if (IsPlane(topo_face))
+			if (in_face_index != TopologyCache::InvalidIndex && IsCachedPlane(in_face_index))
 			{
-				ShellKey shell = (ShellKey)topo_face.GetKeys()[0];
-				VectorArray normals;
-				shell.ShowNetVertexNormalsByRange(0, 1, normals);
-				out_normal = normals[0];
+				out_normal = GetCachedPlaneNormal(in_face_index);
 				out_normal = net_modelling_matrix.Transform(out_normal);
 			}
 		};
@@ -524,11 +525,10 @@ bool Exchange::MeasurementOperator::InsertEdgeRadiusMeasurement(KeyPath const &
 
 		Vector normal_one = Vector::Zero();
 		Vector normal_two = Vector::Zero();
-		auto co_edges = edge_component.GetOwners();
-		if (co_edges.size() >= 1)
-			get_face_normal(co_edges[0], normal_one);
-		if (co_edges.size() == 2)
-			get_face_normal(co_edges[1], normal_two);
+		if (cached_edge.coedge_count >= 1)
+			get_face_normal(cached_edge.faces[0], normal_one);
+		if (cached_edge.coedge_count == 2)
+			get_face_normal(cached_edge.faces[1], normal_two);
 
 		if (normal_one != Vector::Zero() || normal_two != Vector::Zero())
 		{
@@ -577,20 +577,18 @@ bool Exchange::MeasurementOperator::InsertEdgeRadiusMeasurement(KeyPath const &
 				explicit_direction = explicit_direction.Normalize();
 			}
 		}
-		else if (co_edges.size() == 2)
+		else if (cached_edge.coedge_count == 2)
 		{
 			//the edge is adjacent to two non-planar faces
 			//check whether one is a cylindrical/conical one
 
-			auto loop = co_edges[0].GetOwners();
-			auto face = loop[0].GetOwners();
 			Exchange::MeasurementOperator::Surface temp_surface_one;
-			GetSurfaceType(Exchange::Component(face[0]), temp_surface_one);
+			if (cached_edge.faces[0] != TopologyCache::InvalidIndex)
+				GetCachedSurfaceType(cached_edge.faces[0], temp_surface_one);
 
-			loop = co_edges[1].GetOwners();
-			face = loop[0].GetOwners();
 			Exchange::MeasurementOperator::Surface temp_surface_two;
-			GetSurfaceType(Exchange::Component(face[0]), temp_surface_two);
+			if (cached_edge.faces[1] != TopologyCache::InvalidIndex)
+				GetCachedSurfaceType(cached_edge.faces[1], temp_surface_two);
 
 			Point normal_points[2];
 			if (temp_surface_two.surface_type == Exchange::MeasurementOperator::Surface::SurfaceType::ConeOrCylinder &&
@@ -758,15 +756,15 @@ bool Exchange::MeasurementOperator::InsertFeatureToFeatureMeasurement(KeyPath co
 
 	//this face key should belong to a component of type exchange topological face.
 	//if this is not the case if probably means the file was imported without b-rep, and there is nothing this operator can do.
-	ComponentPath current_path = cad_model.GetComponentPath(HPS::KeyPath(in_face_key + in_selection_path));
-	HPS::Exchange::Component const & face_component = current_path.Front();
-	if (face_component.GetComponentType() != Component::ComponentType::ExchangeTopoFace)
+	size_t face_index = GetTopology().FindFace(in_face_key);
+	if (face_index == TopologyCache::InvalidIndex)
 		return false;
+	ComponentPath current_path = cad_model.GetComponentPath(HPS::KeyPath(in_face_key + in_selection_path));
 
 	//find the simplified surface type used by this component
 	if (anchors == 0)
 	{
-		GetSurfaceType(face_component, surface_one);
+		GetCachedSurfaceType(face_index, surface_one);
 		if (surface_one.surface_type == Surface::SurfaceType::Unsupported)
 			return false;
 		surface_one.path = current_path;
@@ -776,7 +774,7 @@ bool Exchange::MeasurementOperator::InsertFeatureToFeatureMeasurement(KeyPath co
 		if (current_path == surface_one.path)
 			return false;
 
-		GetSurfaceType(face_component, surface_two);
+		GetCachedSurfaceType(face_index, surface_two);
 		if (surface_two.surface_type == Surface::SurfaceType::Unsupported)
 			return false;
 
@@ -788,31 +786,13 @@ bool Exchange::MeasurementOperator::InsertFeatureToFeatureMeasurement(KeyPath co
 	KeyPath complete_path = in_face_key + in_selection_path;
 	in_window.GetHighlightControl().Highlight(complete_path, highlight_options);
 
-	auto draw_normal = [](Surface & surface, SegmentKey & insert_here, LineKey & normal)
+	auto draw_normal = [this](Surface & surface, SegmentKey & insert_here, LineKey & normal)
 	{
 		if (surface.surface_type == Surface::SurfaceType::ConeOrCylinder)
 		{
-			KeyPath path = surface.path.GetKeyPaths()[0];
-			BoundingKit bounding;
-			path.ShowNetBounding(true, bounding);
-
-			SimpleSphere sphere;
-			SimpleCuboid cuboid;
-			bounding.ShowVolume(sphere, cuboid);
-			float half_diagonal = (float)(cuboid.Diagonal().Length() / 2);
-
-			MatrixKit matrix;
-			path.ShowNetModellingMatrix(matrix);
-			surface.center = matrix.Transform(surface.center);
-			surface.normal = matrix.Transform(surface.normal);
-			surface.normal = surface.normal.Normalize();
-
-			//recompute the surface center so that it corresponds to the face bbx center
-			Vector center_to_bbx_center(sphere.center - surface.center);
-			surface.center = surface.center + surface.normal * surface.normal.Dot(center_to_bbx_center);
-
-			Point point_one = surface.center + surface.normal * half_diagonal;
-			Point point_two = surface.center - surface.normal * half_diagonal;
+			Point point_one;
+			Point point_two;
+			GetCenterLine(surface, surface.path.GetKeyPaths()[0], point_one, point_two);
 			surface.normal_points = insert_here.InsertLine(point_one, point_two);
 			normal = surface.normal_points;
 		}
@@ -887,6 +867,30 @@ bool Exchange::MeasurementOperator::InsertFeatureToFeatureMeasurement(KeyPath co
 	return true;
 }
 
+void Exchange::MeasurementOperator::GetCenterLine(Surface & io_surface, KeyPath const & in_path, Point & out_point_one, Point & out_point_two)
+{
+	BoundingKit bounding;
+	in_path.ShowNetBounding(true, bounding);
+
+	SimpleSphere sphere;
+	SimpleCuboid cuboid;
+	bounding.ShowVolume(sphere, cuboid);
+	float half_diagonal = (float)(cuboid.Diagonal().Length() / 2);
+
+	MatrixKit matrix;
+	in_path.ShowNetModellingMatrix(matrix);
+	io_surface.center = matrix.Transform(io_surface.center);
+	io_surface.normal = matrix.Transform(io_surface.normal);
+	io_surface.normal = io_surface.normal.Normalize();
+
+	//recompute the surface center so that it corresponds to the face bbx center
+	Vector center_to_bbx_center(sphere.center - io_surface.center);
+	io_surface.center = io_surface.center + io_surface.normal * io_surface.normal.Dot(center_to_bbx_center);
+
+	out_point_one = io_surface.center + io_surface.normal * half_diagonal;
+	out_point_two = io_surface.center - io_surface.normal * half_diagonal;
+}
+
 void Exchange::MeasurementOperator::InsertFeatureToFeatureGeometry(Point const & point_one, Point const & point_two, float distance)
 {
 	SegmentKey patterned_line_segment = current_measurement.Subsegment("patterned_line");
@@ -920,28 +924,25 @@ bool Exchange::MeasurementOperator::InsertAngleMeasurement(KeyPath const & in_se
 
 	//this edge key should belong to a component of type exchange topological edge.
 	//if this is not the case if probably means the file was imported without b-rep, and there is nothing this operator can do.
-	HPS::Exchange::Component const & face_component = cad_model.GetComponentPath(HPS::KeyPath(in_face_key + in_selection_path)).Front();
-	if (face_component.GetComponentType() != Component::ComponentType::ExchangeTopoFace)
+	size_t face_index = GetTopology().FindFace(in_face_key);
+	if (face_index == TopologyCache::InvalidIndex)
 		return false;
 
 	//this operator only accepts faces whose underlying surface is planar
-	if (!IsPlane(face_component))
+	if (!IsCachedPlane(face_index))
 		return false;
 
 	//get the normals
-	ShellKey shell(face_component.GetKeys()[0]);
-	VectorArray normals;
-	shell.ShowNetVertexNormalsByRange(0, 1, normals);
 	HPS::KeyPath shell_path(in_face_key + in_selection_path);
 	MatrixKit net_matrix;
 	shell_path.ShowNetModellingMatrix(net_matrix);
-	normals = net_matrix.Transform(normals);
-	normals[0] = normals[0].Normalize();
+	Vector face_normal = net_matrix.Transform(GetCachedPlaneNormal(face_index));
+	face_normal = face_normal.Normalize();
 
 	if (anchors == 0)
-		first_face_normal = normals[0];
+		first_face_normal = face_normal;
 	else
-		second_face_normal = normals[0];
+		second_face_normal = face_normal;
 
 	if (current_measurement.Empty())
 		current_measurement = measurement_segment.Subsegment(CommonMeasurementOperator::GetNewMeasurementSegmentName("Angle"));
@@ -1006,15 +1007,11 @@ bool Exchange::MeasurementOperator::InsertAngleMeasurement(KeyPath const & in_se
 		leader_line_one_direction = line_to_leader_line_direction.Cross(first_face_normal);
 		leader_line_one_direction = leader_line_one_direction.Normalize();
 
-		HPS::BoundingKit model_bounding;
 		float scene_size = 1000.0f;
-		if (GetAttachedView().GetAttachedModel().GetSegmentKey().ShowBounding(model_bounding))
-		{
-			HPS::SimpleSphere sphere;
-			HPS::SimpleCuboid cuboid;
-			model_bounding.ShowVolume(sphere, cuboid);
+		HPS::SimpleSphere sphere;
+		HPS::SimpleCuboid cuboid;
+		if (BoundingCache::ShowVolume(GetAttachedView().GetAttachedModel().GetSegmentKey(), sphere, cuboid))
 			scene_size = sphere.radius * 2.5f;
-		}
 
 		//get the circle center
 		Plane plane(second_click_position, second_face_normal);
@@ -1551,6 +1548,10 @@ bool Exchange::MeasurementOperator::InputUp(WindowKey & in_window)
 	//tag the measurements with user data so that they can be restored when manipulating the measurement
 	TagMeasurement();
 
+	//measurements live in the model, so they change its bounding and what can be selected
+	BoundingCache::Invalidate(GetAttachedView().GetAttachedModel());
+	SelectionCache::Invalidate(GetAttachedView().GetAttachedModel());
+
 	if (!manipulate_measurement)
 	{
 		CommonMeasurementOperator::MeasurementInsertedEvent event(current_measurement, GetAttachedView());
@@ -1596,35 +1597,34 @@ bool Exchange::MeasurementOperator::InputUp(WindowKey & in_window)
 
 void Exchange::MeasurementOperator::RestoreMeasurement(SegmentKey const & measurement_segment_key)
 {
-	ByteArray data;
-	measurement_segment_key.ShowUserData(static_cast<size_t>(CommonMeasurementOperator::Tags::MeasurementType), data);
+	MeasurementRecord const & record = GetMeasurementRecord(measurement_segment_key);
 
-	if (strcmp((const char *)data.data(), "point_to_point") == 0)
+	if (record.measurement_type == "point_to_point")
 	{
 		RestorePointToPointMeasurement(measurement_segment_key);
 		temporary_measurement_type = MeasurementType::PointToPoint;
 	}
-	else if (strcmp((const char *)data.data(), "edge_line") == 0)
+	else if (record.measurement_type == "edge_line")
 	{
 		RestoreEdgeMeasurement(measurement_segment_key);
 		temporary_measurement_type = MeasurementType::EdgeAndRadius;
 	}
-	else if (strcmp((const char *)data.data(), "edge_circle") == 0)
+	else if (record.measurement_type == "edge_circle")
 	{
 		RestoreRadiusMeasurement(measurement_segment_key);
 		temporary_measurement_type = MeasurementType::EdgeAndRadius;
 	}
-	else if (strcmp((const char *)data.data(), "edge_generic") == 0)
+	else if (record.measurement_type == "edge_generic")
 	{
 		RestoreGenericEdgeMeasurement(measurement_segment_key);
 		temporary_measurement_type = MeasurementType::EdgeAndRadius;
 	}
-	else if (strcmp((const char *)data.data(), "face_distance") == 0)
+	else if (record.measurement_type == "face_distance")
 	{
 		RestoreFeatureToFeatureMeasurement(measurement_segment_key);
 		temporary_measurement_type = MeasurementType::FeatureToFeature;
 	}
-	else if (strcmp((const char *)data.data(), "face_angle") == 0)
+	else if (record.measurement_type == "face_angle")
 	{
 		RestoreAngleMeasurement(measurement_segment_key);
 		temporary_measurement_type = MeasurementType::FaceAngle;
@@ -1632,12 +1632,7 @@ void Exchange::MeasurementOperator::RestoreMeasurement(SegmentKey const & measur
 	else
 		return;
 
-	measurement_segment_key.ShowUserData(static_cast<size_t>(CommonMeasurementOperator::Tags::VectorX), data);
-	camera_direction.x = (float)atof((const char *)data.data());
-	measurement_segment_key.ShowUserData(static_cast<size_t>(CommonMeasurementOperator::Tags::VectorY), data);
-	camera_direction.y = (float)atof((const char *)data.data());
-	measurement_segment_key.ShowUserData(static_cast<size_t>(CommonMeasurementOperator::Tags::VectorZ), data);
-	camera_direction.z = (float)atof((const char *)data.data());
+	camera_direction = record.camera_direction;
 
 	manipulate_measurement = true;
 
@@ -1648,68 +1643,19 @@ void Exchange::MeasurementOperator::RestoreMeasurement(SegmentKey const & measur
 
 void Exchange::MeasurementOperator::RestorePointToPointMeasurement(SegmentKey const & measurement_segment_key)
 {
-	SearchOptionsKit search_options;
-	SearchTypeArray search_types;
-	search_types.push_back(Search::Type::Line);
-	search_types.push_back(Search::Type::Marker);
-	search_types.push_back(Search::Type::Text);
-	search_options.SetCriteria(search_types).SetSearchSpace(Search::Space::Subsegments);
-	SearchResults search_results;
-	measurement_segment_key.Find(search_options, search_results);
-
-	ByteArray data;
-	MarkerKey distance_marker_one, distance_marker_two;
-	auto it = search_results.GetIterator();
-	while (it.IsValid())
-	{
-		Key item = it.GetItem();
-		HPS::Type item_type = item.Type();
-		if (item_type == HPS::Type::MarkerKey)
-		{
-			MarkerKey marker_key(item);
-			marker_key.ShowUserData(static_cast<size_t>(CommonMeasurementOperator::Tags::Name), data);
-			UTF8 marker_data((const char *)data.data(), "utf8");
-
-			if (marker_data == "distance_marker_one")
-				distance_marker_one = marker_key;
-			else if (marker_data == "distance_marker_two")
-				distance_marker_two = marker_key;
-			else if (marker_data == "anchor_one")
-				anchor_one = marker_key;
-			else if (marker_data == "anchor_two")
-				anchor_two = marker_key;
-		}
-		else if (item_type == HPS::Type::LineKey)
-		{
-			LineKey line_key(item);
-			line_key.ShowUserData(static_cast<size_t>(CommonMeasurementOperator::Tags::Name), data);
-			UTF8 line_data((const char *)data.data(), "utf8");
-
-			if (line_data == "distance_line")
-				distance_line = line_key;
-			else if (line_data == "leader_line_one")
-				leader_line_one = line_key;
-			else if (line_data == "leader_line_two")
-				leader_line_two = line_key;
-			else if (line_data == "line_to_cursor")
-				line_to_cursor = line_key;
-		}
-		else if (item_type == HPS::Type::TextKey)
-		{
-			TextKey text_key(item);
-			text_key.ShowUserData(static_cast<size_t>(CommonMeasurementOperator::Tags::Name), data);
-			UTF8 text_data((const char *)data.data(), "utf8");
-
-			if (text_data == "text")
-				text = text_key;
-		}
-		it.Next();
-	}
+	MeasurementRecord const & record = GetMeasurementRecord(measurement_segment_key);
+	anchor_one = record.anchor_one;
+	anchor_two = record.anchor_two;
+	distance_line = record.distance_line;
+	leader_line_one = record.leader_line_one;
+	leader_line_two = record.leader_line_two;
+	line_to_cursor = record.line_to_cursor;
+	text = record.text;
 
 	anchor_one.ShowPoint(first_click_position);
 	anchor_two.ShowPoint(second_click_position);
-	distance_marker_one.ShowPoint(distance_point_one);
-	distance_marker_two.ShowPoint(distance_point_two);
+	record.distance_marker_one.ShowPoint(distance_point_one);
+	record.distance_marker_two.ShowPoint(distance_point_two);
 	text.ShowText(text_string);
 
 	anchors_in_place = false;
@@ -1721,79 +1667,25 @@ void Exchange::MeasurementOperator::RestorePointToPointMeasurement(SegmentKey co
 
 void Exchange::MeasurementOperator::RestoreEdgeMeasurement(SegmentKey const & measurement_segment_key)
 {
-	SearchOptionsKit search_options;
-	SearchTypeArray search_types;
-	search_types.push_back(Search::Type::Line);
-	search_types.push_back(Search::Type::Marker);
-	search_types.push_back(Search::Type::Text);
-	search_options.SetCriteria(search_types).SetSearchSpace(Search::Space::Subsegments);
-	SearchResults search_results;
-	measurement_segment_key.Find(search_options, search_results);
-
-	ByteArray data;
-	MarkerKey distance_marker_one, distance_marker_two;
-	auto it = search_results.GetIterator();
-	while (it.IsValid())
+	MeasurementRecord const & record = GetMeasurementRecord(measurement_segment_key);
+	distance_line = record.distance_line;
+	leader_line_one = record.leader_line_one;
+	leader_line_two = record.leader_line_two;
+	line_to_cursor = record.line_to_cursor;
+	edge_line = record.edge_line;
+	text = record.text;
+	if (record.has_explicit_direction)
 	{
-		Key item = it.GetItem();
-		HPS::Type item_type = item.Type();
-		if (item_type == HPS::Type::MarkerKey)
-		{
-			MarkerKey marker_key(item);
-			marker_key.ShowUserData(static_cast<size_t>(CommonMeasurementOperator::Tags::Name), data);
-			UTF8 marker_data((const char *)data.data(), "utf8");
-
-			if (marker_data == "distance_marker_one")
-				distance_marker_one = marker_key;
-			else if (marker_data == "distance_marker_two")
-				distance_marker_two = marker_key;
-		}
-		else if (item_type == HPS::Type::LineKey)
-		{
-			LineKey line_key(item);
-			line_key.ShowUserData(static_cast<size_t>(CommonMeasurementOperator::Tags::Name), data);
-			UTF8 line_data((const char *)data.data(), "utf8");
-
-			if (line_data == "distance_line")
-				distance_line = line_key;
-			else if (line_data == "leader_line_one")
-				leader_line_one = line_key;
-			else if (line_data == "leader_line_two")
-				leader_line_two = line_key;
-			else if (line_data == "line_to_cursor")
-				line_to_cursor = line_key;
-			else if (line_data == "edge_line")
-			{
-				edge_line = line_key;
-				if (edge_line.ShowUserData(static_cast<size_t>(CommonMeasurementOperator::Tags::VectorX), data))
-				{
-					use_explicit_direction = true;
-					explicit_direction.x = (float)atof((const char *)data.data());
-					edge_line.ShowUserData(static_cast<size_t>(CommonMeasurementOperator::Tags::VectorY), data);
-					explicit_direction.y = (float)atof((const char *)data.data());
-					edge_line.ShowUserData(static_cast<size_t>(CommonMeasurementOperator::Tags::VectorZ), data);
-					explicit_direction.z = (float)atof((const char *)data.data());
-				}
-			}
-		}
-		else if (item_type == HPS::Type::TextKey)
-		{
-			TextKey text_key(item);
-			text_key.ShowUserData(static_cast<size_t>(CommonMeasurementOperator::Tags::Name), data);
-			UTF8 text_data((const char *)data.data(), "utf8");
-
-			if (text_data == "text")
-				text = text_key;
-		}
-		it.Next();
+		use_explicit_direction = true;
+		explicit_direction = record.explicit_direction;
 	}
 
 	PointArray edge_points;
 	edge_line.ShowPoints(edge_points);
 	first_click_position = edge_points[0];
 	second_click_position = edge_points.back();
-	distance_marker_one.ShowPoint(distance_point_one);
-	distance_marker_two.ShowPoint(distance_point_two);
+	record.distance_marker_one.ShowPoint(distance_point_one);
+	record.distance_marker_two.ShowPoint(distance_point_two);
 	text.ShowText(text_string);
 
 	measurement_direction = Vector(second_click_position - first_click_position);
@@ -1805,42 +1697,9 @@ void Exchange::MeasurementOperator::RestoreEdgeMeasurement(SegmentKey const & me
 
 void Exchange::MeasurementOperator::RestoreGenericEdgeMeasurement(SegmentKey const & measurement_segment_key)
 {
-	SearchOptionsKit search_options;
-	SearchTypeArray search_types;
-	search_types.push_back(Search::Type::Line);
-	search_types.push_back(Search::Type::Text);
-	search_options.SetCriteria(search_types).SetSearchSpace(Search::Space::Subsegments);
-	SearchResults search_results;
-	measurement_segment_key.Find(search_options, search_results);
-
-	ByteArray data;
-	auto it = search_results.GetIterator();
-	while (it.IsValid())
-	{
-		Key item = it.GetItem();
-		HPS::Type item_type = item.Type();
-		if (item_type == HPS::Type::LineKey)
-		{
-			LineKey line_key(item);
-			if (line_key.ShowUserData(static_cast<size_t>(CommonMeasurementOperator::Tags::Name), data))
-			{
-				UTF8 line_data((const char *)data.data(), "utf8");
-
-				if (line_data == "line_to_cursor")
-					line_to_cursor = line_key;
-			}
-		}
-		else if (item_type == HPS::Type::TextKey)
-		{
-			TextKey text_key(item);
-			text_key.ShowUserData(static_cast<size_t>(CommonMeasurementOperator::Tags::Name), data);
-			UTF8 text_data((const char *)data.data(), "utf8");
-
-			if (text_data == "text")
-				text = text_key;
-		}
-		it.Next();
-	}
+	MeasurementRecord const & record = GetMeasurementRecord(measurement_segment_key);
+	line_to_cursor = record.line_to_cursor;
+	text = record.text;
 
 	text.ShowText(text_string);
 	current_measurement = measurement_segment_key;
@@ -1850,60 +1709,17 @@ void Exchange::MeasurementOperator::RestoreGenericEdgeMeasurement(SegmentKey con
 
 void Exchange::MeasurementOperator::RestoreRadiusMeasurement(SegmentKey const & measurement_segment_key)
 {
-	SearchOptionsKit search_options;
-	SearchTypeArray search_types;
-	search_types.push_back(Search::Type::Line);
-	search_types.push_back(Search::Type::Marker);
-	search_types.push_back(Search::Type::Text);
-	search_options.SetCriteria(search_types).SetSearchSpace(Search::Space::Subsegments);
-	SearchResults search_results;
-	measurement_segment_key.Find(search_options, search_results);
-
-	ByteArray data;
-	MarkerKey distance_marker_one, distance_marker_two;
-	auto it = search_results.GetIterator();
-	while (it.IsValid())
+	MeasurementRecord const & record = GetMeasurementRecord(measurement_segment_key);
+	if (record.center_marker.Type() != HPS::Type::None)
 	{
-		Key item = it.GetItem();
-		HPS::Type item_type = item.Type();
-		if (item_type == HPS::Type::MarkerKey)
-		{
-			MarkerKey marker_key(item);
-			marker_key.ShowUserData(static_cast<size_t>(CommonMeasurementOperator::Tags::Name), data);
-			UTF8 marker_data((const char *)data.data(), "utf8");
-
-			if (marker_data == "center_marker")
-			{
-				center_marker = marker_key;
-				marker_key.ShowUserData(static_cast<size_t>(CommonMeasurementOperator::Tags::Radius), data);
-				radius = (float)atof((const char *)data.data());
-				center_marker.ShowPoint(circle_center);
-			}
-		}
-		else if (item_type == HPS::Type::LineKey)
-		{
-			LineKey line_key(item);
-			line_key.ShowUserData(static_cast<size_t>(CommonMeasurementOperator::Tags::Name), data);
-			UTF8 line_data((const char *)data.data(), "utf8");
-
-			if (line_data == "distance_line")
-				distance_line = line_key;
-			else if (line_data == "line_to_cursor")
-				line_to_cursor = line_key;
-			else if (line_data == "edge_line")
-				edge_line = line_key;
-		}
-		else if (item_type == HPS::Type::TextKey)
-		{
-			TextKey text_key(item);
-			text_key.ShowUserData(static_cast<size_t>(CommonMeasurementOperator::Tags::Name), data);
-			UTF8 text_data((const char *)data.data(), "utf8");
-
-			if (text_data == "text")
-				text = text_key;
-		}
-		it.Next();
+		center_marker = record.center_marker;
+		radius = record.radius;
+		center_marker.ShowPoint(circle_center);
 	}
+	distance_line = record.distance_line;
+	line_to_cursor = record.line_to_cursor;
+	edge_line = record.edge_line;
+	text = record.text;
 
 	text.ShowText(text_string);
 
@@ -1913,82 +1729,24 @@ void Exchange::MeasurementOperator::RestoreRadiusMeasurement(SegmentKey const &
 
 void Exchange::MeasurementOperator::RestoreFeatureToFeatureMeasurement(SegmentKey const & measurement_segment_key)
 {
-	SearchOptionsKit search_options;
-	SearchTypeArray search_types;
-	search_types.push_back(Search::Type::Line);
-	search_types.push_back(Search::Type::Marker);
-	search_types.push_back(Search::Type::Text);
-	search_options.SetCriteria(search_types).SetSearchSpace(Search::Space::Subsegments);
-	SearchResults search_results;
-	measurement_segment_key.Find(search_options, search_results);
-
-	ByteArray data;
-	MarkerKey distance_marker_one, distance_marker_two;
-	auto it = search_results.GetIterator();
-	while (it.IsValid())
+	MeasurementRecord const & record = GetMeasurementRecord(measurement_segment_key);
+	anchor_one = record.anchor_one;
+	anchor_two = record.anchor_two;
+	distance_line = record.distance_line;
+	leader_line_one = record.leader_line_one;
+	leader_line_two = record.leader_line_two;
+	line_to_cursor = record.line_to_cursor;
+	text = record.text;
+	if (record.has_explicit_direction)
 	{
-		Key item = it.GetItem();
-		HPS::Type item_type = item.Type();
-		if (item_type == HPS::Type::MarkerKey)
-		{
-			MarkerKey marker_key(item);
-			marker_key.ShowUserData(static_cast<size_t>(CommonMeasurementOperator::Tags::Name), data);
-			UTF8 marker_data((const char *)data.data(), "utf8");
-
-			if (marker_data == "distance_marker_one")
-				distance_marker_one = marker_key;
-			else if (marker_data == "distance_marker_two")
-				distance_marker_two = marker_key;
-			else if (marker_data == "anchor_one")
-				anchor_one = marker_key;
-			else if (marker_data == "anchor_two")
-				anchor_two = marker_key;
-		}
-		else if (item_type == HPS::Type::LineKey)
-		{
-			LineKey line_key(item);
-			if (line_key.ShowUserData(static_cast<size_t>(CommonMeasurementOperator::Tags::Name), data))
-			{
-				UTF8 line_data((const char *)data.data(), "utf8");
-
-				if (line_data == "distance_line")
-				{
-					distance_line = line_key;
-
-					if (distance_line.ShowUserData(static_cast<size_t>(CommonMeasurementOperator::Tags::VectorX), data))
-					{
-						use_explicit_direction = true;
-						explicit_direction.x = (float)atof((const char *)data.data());
-						distance_line.ShowUserData(static_cast<size_t>(CommonMeasurementOperator::Tags::VectorY), data);
-						explicit_direction.y = (float)atof((const char *)data.data());
-						distance_line.ShowUserData(static_cast<size_t>(CommonMeasurementOperator::Tags::VectorZ), data);
-						explicit_direction.z = (float)atof((const char *)data.data());
-					}
-				}
-				else if (line_data == "leader_line_one")
-					leader_line_one = line_key;
-				else if (line_data == "leader_line_two")
-					leader_line_two = line_key;
-				else if (line_data == "line_to_cursor")
-					line_to_cursor = line_key;
-			}
-		}
-		else if (item_type == HPS::Type::TextKey)
-		{
-			TextKey text_key(item);
-			text_key.ShowUserData(static_cast<size_t>(CommonMeasurementOperator::Tags::Name), data);
-			UTF8 text_data((const char *)data.data(), "utf8");
-
-			if (text_data == "text")
-				text = text_key;
-		}
-		it.Next();
+		use_explicit_direction = true;
+		explicit_direction = record.explicit_direction;
 	}
 
 	anchor_one.ShowPoint(first_click_position);
 	anchor_two.ShowPoint(second_click_position);
-	distance_marker_one.ShowPoint(distance_point_one);
-	distance_marker_two.ShowPoint(distance_point_two);
+	record.distance_marker_one.ShowPoint(distance_point_one);
+	record.distance_marker_two.ShowPoint(distance_point_two);
 	text.ShowText(text_string);
 
 	operator_active = true;
@@ -1999,94 +1757,172 @@ void Exchange::MeasurementOperator::RestoreFeatureToFeatureMeasurement(SegmentKe
 
 void Exchange::MeasurementOperator::RestoreAngleMeasurement(SegmentKey const & measurement_segment_key)
 {
+	MeasurementRecord const & record = GetMeasurementRecord(measurement_segment_key);
+	line_to_leader_line = record.line_to_leader_line;
+	leader_line_one = record.leader_line_one;
+	leader_line_two = record.leader_line_two;
+	line_to_cursor = record.line_to_cursor;
+	text = record.text;
+	measurement_arc = record.measurement_arc;
+	if (record.inverted)
+		inverted_measurement = true;
+	mid_point_direction = record.mid_point_direction;
+
+	record.center_marker.ShowPoint(circle_center);
+	leader_line_one_direction = record.leader_line_one_direction;
+	leader_line_two_direction = record.leader_line_two_direction;
+	text.ShowText(text_string);
+	anchors = 2;
+	anchors_in_place = false;
+	current_measurement = measurement_segment_key;
+}
+
+Exchange::MeasurementOperator::MeasurementRecord::MeasurementRecord()
+	: has_explicit_direction(false)
+	, radius(0.0f)
+	, inverted(false)
+{
+}
+
+Exchange::MeasurementOperator::MeasurementRecord & Exchange::MeasurementOperator::GetMeasurementRecord(SegmentKey const & measurement_segment_key)
+{
+	auto it = measurement_index.find(measurement_segment_key);
+	if (it != measurement_index.end() && it->second.text.Type() != HPS::Type::None)
+		return it->second;
+
+	//this measurement was not tagged during this session (for example it was loaded from a file), index it once
+	MeasurementRecord & record = measurement_index[measurement_segment_key];
+	record = MeasurementRecord();
+	IndexMeasurement(measurement_segment_key, record);
+	return record;
+}
+
+void Exchange::MeasurementOperator::IndexMeasurement(SegmentKey const & measurement_segment_key, MeasurementRecord & out_record)
+{
+	ByteArray data;
+	auto show_name = [&data](GeometryKey const & key, UTF8 & out_name)
+	{
+		if (!key.ShowUserData(static_cast<size_t>(CommonMeasurementOperator::Tags::Name), data))
+			return false;
+		out_name = UTF8((const char *)data.data(), "utf8");
+		return true;
+	};
+
+	auto show_vector = [&data](GeometryKey const & key, Vector & out_vector)
+	{
+		if (!key.ShowUserData(static_cast<size_t>(CommonMeasurementOperator::Tags::VectorX), data))
+			return false;
+		out_vector.x = (float)atof((const char *)data.data());
+		key.ShowUserData(static_cast<size_t>(CommonMeasurementOperator::Tags::VectorY), data);
+		out_vector.y = (float)atof((const char *)data.data());
+		key.ShowUserData(static_cast<size_t>(CommonMeasurementOperator::Tags::VectorZ), data);
+		out_vector.z = (float)atof((const char *)data.data());
+		return true;
+	};
+
+	if (measurement_segment_key.ShowUserData(static_cast<size_t>(CommonMeasurementOperator::Tags::MeasurementType), data))
+		out_record.measurement_type = UTF8((const char *)data.data(), "utf8");
+	if (measurement_segment_key.ShowUserData(static_cast<size_t>(CommonMeasurementOperator::Tags::VectorX), data))
+	{
+		out_record.camera_direction.x = (float)atof((const char *)data.data());
+		measurement_segment_key.ShowUserData(static_cast<size_t>(CommonMeasurementOperator::Tags::VectorY), data);
+		out_record.camera_direction.y = (float)atof((const char *)data.data());
+		measurement_segment_key.ShowUserData(static_cast<size_t>(CommonMeasurementOperator::Tags::VectorZ), data);
+		out_record.camera_direction.z = (float)atof((const char *)data.data());
+	}
+
 	SearchOptionsKit search_options;
 	SearchTypeArray search_types;
 	search_types.push_back(Search::Type::Line);
+	search_types.push_back(Search::Type::Marker);
 	search_types.push_back(Search::Type::Text);
 	search_types.push_back(Search::Type::CircularArc);
-	search_types.push_back(Search::Type::Marker);
 	search_options.SetCriteria(search_types).SetSearchSpace(Search::Space::Subsegments);
 	SearchResults search_results;
 	measurement_segment_key.Find(search_options, search_results);
 
-	ByteArray data;
-	MarkerKey center_marker_key;
-	LineKey distance_line_one, distance_line_two;
+	UTF8 name;
 	auto it = search_results.GetIterator();
 	while (it.IsValid())
 	{
 		Key item = it.GetItem();
+		it.Next();
+
+		if (!show_name(GeometryKey(item), name))
+			continue;
+
 		HPS::Type item_type = item.Type();
-		if (item_type == HPS::Type::LineKey)
+		if (item_type == HPS::Type::MarkerKey)
 		{
-			LineKey line_key(item);
-			line_key.ShowUserData(static_cast<size_t>(CommonMeasurementOperator::Tags::Name), data);
-			UTF8 line_data((const char *)data.data(), "utf8");
-
-			if (line_data == "line_to_leader_line")
-				line_to_leader_line = line_key;
-			else if (line_data == "leader_line_one")
-				leader_line_one = line_key;
-			else if (line_data == "leader_line_two")
-				leader_line_two = line_key;
-			else if (line_data == "direction_one")
-				distance_line_one = line_key;
-			else if (line_data == "direction_two")
-				distance_line_two = line_key;
-			else if (line_data == "line_to_cursor")
-				line_to_cursor = line_key;
+			MarkerKey marker_key(item);
+			if (name == "distance_marker_one")
+				out_record.distance_marker_one = marker_key;
+			else if (name == "distance_marker_two")
+				out_record.distance_marker_two = marker_key;
+			else if (name == "anchor_one")
+				out_record.anchor_one = marker_key;
+			else if (name == "anchor_two")
+				out_record.anchor_two = marker_key;
+			else if (name == "center")
+				out_record.center_marker = marker_key;
+			else if (name == "center_marker")
+			{
+				out_record.center_marker = marker_key;
+				if (marker_key.ShowUserData(static_cast<size_t>(CommonMeasurementOperator::Tags::Radius), data))
+					out_record.radius = (float)atof((const char *)data.data());
+			}
 		}
-		else if (item_type == HPS::Type::TextKey)
+		else if (item_type == HPS::Type::LineKey)
 		{
-			TextKey text_key(item);
-			text_key.ShowUserData(static_cast<size_t>(CommonMeasurementOperator::Tags::Name), data);
-			UTF8 text_data((const char *)data.data(), "utf8");
-
-			if (text_data == "text")
-				text = text_key;
+			LineKey line_key(item);
+			if (name == "distance_line")
+			{
+				out_record.distance_line = line_key;
+				if (show_vector(line_key, out_record.explicit_direction))
+					out_record.has_explicit_direction = true;
+			}
+			else if (name == "edge_line")
+			{
+				out_record.edge_line = line_key;
+				if (show_vector(line_key, out_record.explicit_direction))
+					out_record.has_explicit_direction = true;
+			}
+			else if (name == "leader_line_one")
+				out_record.leader_line_one = line_key;
+			else if (name == "leader_line_two")
+				out_record.leader_line_two = line_key;
+			else if (name == "line_to_cursor")
+				out_record.line_to_cursor = line_key;
+			else if (name == "line_to_leader_line")
+				out_record.line_to_leader_line = line_key;
+			else if (name == "direction_one" || name == "direction_two")
+			{
+				PointArray points;
+				line_key.ShowPoints(points);
+				if (name == "direction_one")
+					out_record.leader_line_one_direction = Vector(points[1]);
+				else
+					out_record.leader_line_two_direction = Vector(points[1]);
+			}
 		}
-		else if (item_type == HPS::Type::MarkerKey)
+		else if (item_type == HPS::Type::TextKey)
 		{
-			MarkerKey marker_key(item);
-			marker_key.ShowUserData(static_cast<size_t>(CommonMeasurementOperator::Tags::Name), data);
-			UTF8 marker_data((const char *)data.data(), "utf8");
-
-			if (marker_data == "center")
-				center_marker_key = marker_key;
+			if (name == "text")
+				out_record.text = TextKey(item);
 		}
 		else if (item_type == HPS::Type::CircularArcKey)
 		{
-			CircularArcKey circular_arc_key(item);
-			circular_arc_key.ShowUserData(static_cast<size_t>(CommonMeasurementOperator::Tags::Name), data);
-			UTF8 circular_arc_data((const char *)data.data(), "utf8");
-
-			if (circular_arc_data == "measurement_arc")
+			if (name == "measurement_arc")
 			{
-				measurement_arc = circular_arc_key;
+				CircularArcKey circular_arc_key(item);
+				out_record.measurement_arc = circular_arc_key;
 				if (circular_arc_key.ShowUserData(static_cast<size_t>(CommonMeasurementOperator::Tags::Inverted), data) &&
 					strcmp((const char *)data.data(), "inverted") == 0)
-					inverted_measurement = true;
-				circular_arc_key.ShowUserData(static_cast<size_t>(CommonMeasurementOperator::Tags::VectorX), data);
-				mid_point_direction.x = (float)atof((const char *)data.data());
-				circular_arc_key.ShowUserData(static_cast<size_t>(CommonMeasurementOperator::Tags::VectorY), data);
-				mid_point_direction.y = (float)atof((const char *)data.data());
-				circular_arc_key.ShowUserData(static_cast<size_t>(CommonMeasurementOperator::Tags::VectorZ), data);
-				mid_point_direction.z = (float)atof((const char *)data.data());
+					out_record.inverted = true;
+				show_vector(circular_arc_key, out_record.mid_point_direction);
 			}
 		}
-		it.Next();
 	}
-
-	center_marker_key.ShowPoint(circle_center);
-	PointArray points;
-	distance_line_one.ShowPoints(points);
-	leader_line_one_direction = Vector(points[1]);
-	distance_line_two.ShowPoints(points);
-	leader_line_two_direction = Vector(points[1]);
-	text.ShowText(text_string);
-	anchors = 2;
-	anchors_in_place = false;
-	current_measurement = measurement_segment_key;
 }
 
 void Exchange::MeasurementOperator::TagMeasurement()
@@ -2147,6 +1983,22 @@ void Exchange::MeasurementOperator::TagPointToPointMeasurement()
 		CommonMeasurementOperator::Tag(anchor_one, "anchor_one", CommonMeasurementOperator::Tags::Name);
 		CommonMeasurementOperator::Tag(anchor_two, "anchor_two", CommonMeasurementOperator::Tags::Name);
 	}
+
+	MeasurementRecord & record = measurement_index[current_measurement];
+	record.text = text;
+	record.distance_marker_one = distance_marker_one;
+	record.distance_marker_two = distance_marker_two;
+	if (!manipulate_measurement)
+	{
+		record.measurement_type = "point_to_point";
+		record.camera_direction = camera_direction;
+		record.distance_line = distance_line;
+		record.leader_line_one = leader_line_one;
+		record.leader_line_two = leader_line_two;
+		record.line_to_cursor = line_to_cursor;
+		record.anchor_one = anchor_one;
+		record.anchor_two = anchor_two;
+	}
 }
 
 void Exchange::MeasurementOperator::TagEdgeMeasurement()
@@ -2183,6 +2035,23 @@ void Exchange::MeasurementOperator::TagEdgeMeasurement()
 		CommonMeasurementOperator::Tag(line_to_cursor, "line_to_cursor", CommonMeasurementOperator::Tags::Name);
 		CommonMeasurementOperator::Tag(edge_line, "edge_line", CommonMeasurementOperator::Tags::Name);
 	}
+
+	MeasurementRecord & record = measurement_index[current_measurement];
+	record.text = text;
+	record.distance_marker_one = distance_marker_one;
+	record.distance_marker_two = distance_marker_two;
+	if (!manipulate_measurement)
+	{
+		record.measurement_type = "edge_line";
+		record.camera_direction = camera_direction;
+		record.has_explicit_direction = use_explicit_direction;
+		record.explicit_direction = explicit_direction;
+		record.distance_line = distance_line;
+		record.leader_line_one = leader_line_one;
+		record.leader_line_two = leader_line_two;
+		record.line_to_cursor = line_to_cursor;
+		record.edge_line = edge_line;
+	}
 }
 
 void Exchange::MeasurementOperator::TagGenericEdgeMeasurement()
@@ -2198,6 +2067,15 @@ void Exchange::MeasurementOperator::TagGenericEdgeMeasurement()
 		CommonMeasurementOperator::Tag(current_measurement, std::to_string(camera_direction.z).data(), CommonMeasurementOperator::Tags::VectorZ);
 		CommonMeasurementOperator::Tag(line_to_cursor, "line_to_cursor", CommonMeasurementOperator::Tags::Name);
 	}
+
+	MeasurementRecord & record = measurement_index[current_measurement];
+	record.text = text;
+	if (!manipulate_measurement)
+	{
+		record.measurement_type = "edge_generic";
+		record.camera_direction = camera_direction;
+		record.line_to_cursor = line_to_cursor;
+	}
 }
 
 void Exchange::MeasurementOperator::TagRadiusMeasurement()
@@ -2221,6 +2099,19 @@ void Exchange::MeasurementOperator::TagRadiusMeasurement()
 		radius_string << std::fixed << radius;
 		CommonMeasurementOperator::Tag(center_marker, radius_string.str().data(), CommonMeasurementOperator::Tags::Radius);
 	}
+
+	MeasurementRecord & record = measurement_index[current_measurement];
+	record.text = text;
+	if (!manipulate_measurement)
+	{
+		record.measurement_type = "edge_circle";
+		record.camera_direction = camera_direction;
+		record.distance_line = distance_line;
+		record.line_to_cursor = line_to_cursor;
+		record.edge_line = edge_line;
+		record.center_marker = center_marker;
+		record.radius = radius;
+	}
 }
 
 void Exchange::MeasurementOperator::TagFeatureToFeatureMeasurement()
@@ -2258,6 +2149,24 @@ void Exchange::MeasurementOperator::TagFeatureToFeatureMeasurement()
 		CommonMeasurementOperator::Tag(anchor_one, "anchor_one", CommonMeasurementOperator::Tags::Name);
 		CommonMeasurementOperator::Tag(anchor_two, "anchor_two", CommonMeasurementOperator::Tags::Name);
 	}
+
+	MeasurementRecord & record = measurement_index[current_measurement];
+	record.text = text;
+	record.distance_marker_one = distance_marker_one;
+	record.distance_marker_two = distance_marker_two;
+	if (!manipulate_measurement)
+	{
+		record.measurement_type = "face_distance";
+		record.camera_direction = camera_direction;
+		record.has_explicit_direction = use_explicit_direction;
+		record.explicit_direction = explicit_direction;
+		record.distance_line = distance_line;
+		record.leader_line_one = leader_line_one;
+		record.leader_line_two = leader_line_two;
+		record.line_to_cursor = line_to_cursor;
+		record.anchor_one = anchor_one;
+		record.anchor_two = anchor_two;
+	}
 }
 
 void Exchange::MeasurementOperator::TagAngleMeasurement()
@@ -2293,6 +2202,25 @@ void Exchange::MeasurementOperator::TagAngleMeasurement()
 		if (!line_to_cursor.Empty())
 			CommonMeasurementOperator::Tag(line_to_cursor, "line_to_cursor", CommonMeasurementOperator::Tags::Name);
 	}
+
+	MeasurementRecord & record = measurement_index[current_measurement];
+	record.text = text;
+	record.center_marker = center;
+	record.leader_line_one_direction = leader_line_one_direction;
+	record.leader_line_two_direction = leader_line_two_direction;
+	record.mid_point_direction = mid_point_direction;
+	record.inverted = inverted_measurement;
+	//editing an angle inserts a new arc and line to the cursor
+	record.measurement_arc = measurement_arc;
+	record.line_to_cursor = line_to_cursor;
+	if (!manipulate_measurement)
+	{
+		record.measurement_type = "face_angle";
+		record.camera_direction = camera_direction;
+		record.leader_line_one = leader_line_one;
+		record.leader_line_two = leader_line_two;
+		record.line_to_leader_line = line_to_leader_line;
+	}
 }
 
 bool Exchange::MeasurementOperator::OnKeyDown(KeyboardState const & in_state)
@@ -2321,7 +2249,13 @@ void HPS::Exchange::MeasurementOperator::ResetMeasurement()
 	View view = GetAttachedView();
 	auto view_type = view.Type();
 
+	measurement_index.erase(current_measurement);
 	current_measurement.Delete();
+	if (view_type != HPS::Type::None)
+	{
+		BoundingCache::Invalidate(view.GetAttachedModel());
+		SelectionCache::Invalidate(view.GetAttachedModel());
+	}
 	tracked_touch_id = -1;
     current_touch_id = -1;
 
@@ -2754,12 +2688,19 @@ void Exchange::MeasurementOperator::PlaneToPlaneDistance()
 	shell_one.ShowFacelist(facelist_one);
 	shell_two.ShowFacelist(facelist_two);
 
-	size_t facelist_one_size = facelist_one.size();
-	size_t facelist_two_size = facelist_two.size();
-
-	float minimum_distance_squared = (std::numeric_limits<float>::max)();
 	Point point_one;
 	Point point_two;
+	float minimum_distance_squared = TriangleDistanceSquared(shell_one_points, facelist_one, shell_two_points, facelist_two, point_one, point_two);
+
+	InsertFeatureToFeatureGeometry(point_one, point_two, sqrt(minimum_distance_squared));
+}
+
+float Exchange::MeasurementOperator::TriangleDistanceSquared(PointArray const & in_points_one, IntArray const & in_facelist_one, PointArray const & in_points_two, IntArray const & in_facelist_two, Point & out_point_one, Point & out_point_two)
+{
+	size_t facelist_one_size = in_facelist_one.size();
+	size_t facelist_two_size = in_facelist_two.size();
+
+	float minimum_distance_squared = (std::numeric_limits<float>::max)();
 	bool early_out = false;
 
 	//brute-force comparison of the triangle pairs making up the two faces
@@ -2767,16 +2708,16 @@ void Exchange::MeasurementOperator::PlaneToPlaneDistance()
 	for (size_t one = 0; one < facelist_one_size && !early_out; one += 4)
 	{
 		//get the points making up the first triangle
-		Point t11 = shell_one_points[facelist_one[one + 1]];
-		Point t12 = shell_one_points[facelist_one[one + 2]];
-		Point t13 = shell_one_points[facelist_one[one + 3]];
+		Point t11 = in_points_one[in_facelist_one[one + 1]];
+		Point t12 = in_points_one[in_facelist_one[one + 2]];
+		Point t13 = in_points_one[in_facelist_one[one + 3]];
 
 		for (size_t two = 0; two < facelist_two_size; two += 4)
 		{
 			//get the points making up the second triangle
-			Point t21 = shell_two_points[facelist_two[two + 1]];
-			Point t22 = shell_two_points[facelist_two[two + 2]];
-			Point t23 = shell_two_points[facelist_two[two + 3]];
+			Point t21 = in_points_two[in_facelist_two[two + 1]];
+			Point t22 = in_points_two[in_facelist_two[two + 2]];
+			Point t23 = in_points_two[in_facelist_two[two + 3]];
 
 			auto check_distance = [&](Point const & comparison_point, Point const & closest_point)
 			{
@@ -2784,8 +2725,8 @@ void Exchange::MeasurementOperator::PlaneToPlaneDistance()
 				if (distance_squared < minimum_distance_squared)
 				{
 					minimum_distance_squared = (float)distance_squared;
-					point_one = comparison_point;
-					point_two = closest_point;
+					out_point_one = comparison_point;
+					out_point_two = closest_point;
 				}
 
 				if (HPS::Float::Equals(distance_squared, 0.0))
@@ -2803,8 +2744,8 @@ void Exchange::MeasurementOperator::PlaneToPlaneDistance()
 				if (distance < minimum_distance_squared)
 				{
 					minimum_distance_squared = distance;
-					point_one = c1;
-					point_two = c2;
+					out_point_one = c1;
+					out_point_two = c2;
 				}
 
 				if (HPS::Float::Equals(distance, 0.0f))
@@ -2837,42 +2778,42 @@ void Exchange::MeasurementOperator::PlaneToPlaneDistance()
 				break;
 
 			//compute 9 edge-edge tests
-			Point out_point_one, out_point_two;
+			Point segment_point_one, segment_point_two;
 			float squared_distance = (std::numeric_limits<float>::max)();
 
-			squared_distance = ClosestPointSegmentSegment(t11, t12, t21, t22, out_point_one, out_point_two);
-			if (check_distance_2(squared_distance, out_point_one, out_point_two))
+			squared_distance = ClosestPointSegmentSegment(t11, t12, t21, t22, segment_point_one, segment_point_two);
+			if (check_distance_2(squared_distance, segment_point_one, segment_point_two))
 				break;
-			squared_distance = ClosestPointSegmentSegment(t12, t13, t21, t22, out_point_one, out_point_two);
-			if (check_distance_2(squared_distance, out_point_one, out_point_two))
+			squared_distance = ClosestPointSegmentSegment(t12, t13, t21, t22, segment_point_one, segment_point_two);
+			if (check_distance_2(squared_distance, segment_point_one, segment_point_two))
 				break;
-			squared_distance = ClosestPointSegmentSegment(t13, t11, t21, t22, out_point_one, out_point_two);
-			if (check_distance_2(squared_distance, out_point_one, out_point_two))
+			squared_distance = ClosestPointSegmentSegment(t13, t11, t21, t22, segment_point_one, segment_point_two);
+			if (check_distance_2(squared_distance, segment_point_one, segment_point_two))
 				break;
 
-			squared_distance = ClosestPointSegmentSegment(t11, t12, t22, t23, out_point_one, out_point_two);
-			if (check_distance_2(squared_distance, out_point_one, out_point_two))
+			squared_distance = ClosestPointSegmentSegment(t11, t12, t22, t23, segment_point_one, segment_point_two);
+			if (check_distance_2(squared_distance, segment_point_one, segment_point_two))
 				break;
-			squared_distance = ClosestPointSegmentSegment(t12, t13, t22, t23, out_point_one, out_point_two);
-			if (check_distance_2(squared_distance, out_point_one, out_point_two))
+			squared_distance = ClosestPointSegmentSegment(t12, t13, t22, t23, segment_point_one, segment_point_two);
+			if (check_distance_2(squared_distance, segment_point_one, segment_point_two))
 				break;
-			squared_distance = ClosestPointSegmentSegment(t13, t11, t22, t23, out_point_one, out_point_two);
-			if (check_distance_2(squared_distance, out_point_one, out_point_two))
+			squared_distance = ClosestPointSegmentSegment(t13, t11, t22, t23, segment_point_one, segment_point_two);
+			if (check_distance_2(squared_distance, segment_point_one, segment_point_two))
 				break;
 
-			squared_distance = ClosestPointSegmentSegment(t11, t12, t23, t21, out_point_one, out_point_two);
-			if (check_distance_2(squared_distance, out_point_one, out_point_two))
+			squared_distance = ClosestPointSegmentSegment(t11, t12, t23, t21, segment_point_one, segment_point_two);
+			if (check_distance_2(squared_distance, segment_point_one, segment_point_two))
 				break;
-			squared_distance = ClosestPointSegmentSegment(t12, t13, t23, t21, out_point_one, out_point_two);
-			if (check_distance_2(squared_distance, out_point_one, out_point_two))
+			squared_distance = ClosestPointSegmentSegment(t12, t13, t23, t21, segment_point_one, segment_point_two);
+			if (check_distance_2(squared_distance, segment_point_one, segment_point_two))
 				break;
-			squared_distance = ClosestPointSegmentSegment(t13, t11, t23, t21, out_point_one, out_point_two);
-			if (check_distance_2(squared_distance, out_point_one, out_point_two))
+			squared_distance = ClosestPointSegmentSegment(t13, t11, t23, t21, segment_point_one, segment_point_two);
+			if (check_distance_2(squared_distance, segment_point_one, segment_point_two))
 				break;
 		}
 	}
 
-	InsertFeatureToFeatureGeometry(point_one, point_two, sqrt(minimum_distance_squared));
+	return minimum_distance_squared;
 }
 
 void Exchange::MeasurementOperator::LineToLineDistance()
@@ -2973,16 +2914,23 @@ float Exchange::MeasurementOperator::LineSegmentDistance(Point & p0, Point & p1,
 	out_point_on_center_line = p0 + u * sc;
 
 	//resize the normal line if needed
+	//headless measurements have no geometry, so only the end points are updated
 	if (sc < 0)
 	{
-		Point normal_points[] = { out_point_on_center_line, p1 };
-		normal_one.EditPointsByReplacement(0, 2, normal_points);
+		if (normal_one.Type() != HPS::Type::None)
+		{
+			Point normal_points[] = { out_point_on_center_line, p1 };
+			normal_one.EditPointsByReplacement(0, 2, normal_points);
+		}
 		p0 = out_point_on_center_line;
 	}
 	else if (sc > 1)
 	{
-		Point normal_points[] = { p0, out_point_on_center_line };
-		normal_one.EditPointsByReplacement(0, 2, normal_points);
+		if (normal_one.Type() != HPS::Type::None)
+		{
+			Point normal_points[] = { p0, out_point_on_center_line };
+			normal_one.EditPointsByReplacement(0, 2, normal_points);
+		}
 		p1 = out_point_on_center_line;
 	}
 
@@ -2991,14 +2939,20 @@ float Exchange::MeasurementOperator::LineSegmentDistance(Point & p0, Point & p1,
 		//resize the other line if we are doing a comparison between two infinite lines
 		if (tc < 0)
 		{
-			Point normal_points[] = { out_point_on_edge, q1 };
-			normal_two.EditPointsByReplacement(0, 2, normal_points);
+			if (normal_two.Type() != HPS::Type::None)
+			{
+				Point normal_points[] = { out_point_on_edge, q1 };
+				normal_two.EditPointsByReplacement(0, 2, normal_points);
+			}
 			q0 = out_point_on_edge;
 		}
 		else if (sc > 1)
 		{
-			Point normal_points[] = { q0, out_point_on_edge };
-			normal_two.EditPointsByReplacement(0, 2, normal_points);
+			if (normal_two.Type() != HPS::Type::None)
+			{
+				Point normal_points[] = { q0, out_point_on_edge };
+				normal_two.EditPointsByReplacement(0, 2, normal_points);
+			}
 			q1 = out_point_on_edge;
 		}
 	}
@@ -3178,6 +3132,193 @@ bool Exchange::MeasurementOperator::IsPlane(Exchange::Component const & face_com
 	return is_plane;
 }
 
+Exchange::MeasurementOperator::TopologyCache::TopologyCache()
+{
+}
+
+void Exchange::MeasurementOperator::TopologyCache::Reset()
+{
+	model = Exchange::CADModel();
+	faces.clear();
+	edges.clear();
+	face_lookup.clear();
+	edge_lookup.clear();
+}
+
+bool Exchange::MeasurementOperator::TopologyCache::IsBuiltFor(Exchange::CADModel const & in_cad_model) const
+{
+	return !model.Empty() && model == in_cad_model;
+}
+
+void Exchange::MeasurementOperator::TopologyCache::Build(Exchange::CADModel const & in_cad_model)
+{
+	Reset();
+	model = in_cad_model;
+	if (model.Empty())
+		return;
+
+	//faces are indexed by the shell which represents them
+	ComponentArray face_components = model.GetAllSubcomponents(Component::ComponentType::ExchangeTopoFace);
+	faces.reserve(face_components.size());
+	for (auto const & face_component : face_components)
+	{
+		Face face;
+		face.component = face_component;
+		face.surface_computed = false;
+		face.surface_type = Surface::SurfaceType::Unsupported;
+		face.plane_normal_computed = false;
+		face.plane_normal = Vector::Zero();
+
+		for (auto const & key : face_component.GetKeys())
+		{
+			if (key.Type() != HPS::Type::ShellKey)
+				continue;
+
+			if (face.shell.Type() == HPS::Type::None)
+				face.shell = ShellKey(key);
+			face_lookup[key] = faces.size();
+		}
+
+		if (face.shell.Type() != HPS::Type::None)
+			faces.push_back(face);
+	}
+
+	//edges are indexed by the lines which represent them, and link to the faces owning their coedges
+	ComponentArray edge_components = model.GetAllSubcomponents(Component::ComponentType::ExchangeTopoEdge);
+	edges.reserve(edge_components.size());
+	for (auto const & edge_component : edge_components)
+	{
+		Edge edge;
+		edge.component = edge_component;
+		edge.faces[0] = InvalidIndex;
+		edge.faces[1] = InvalidIndex;
+		edge.length_computed = false;
+		edge.length = 0.0;
+		edge.type = EdgeType::Generic;
+		edge.radius = 0.0f;
+
+		ComponentArray co_edges = edge_component.GetOwners();
+		edge.coedge_count = co_edges.size();
+		for (size_t i = 0, e = std::min<size_t>(co_edges.size(), 2); i < e; ++i)
+		{
+			ComponentArray loops = co_edges[i].GetOwners();
+			if (loops.empty())
+				continue;
+
+			ComponentArray owning_faces = loops[0].GetOwners();
+			if (owning_faces.empty())
+				continue;
+
+			KeyArray face_keys = owning_faces[0].GetKeys();
+			if (!face_keys.empty())
+				edge.faces[i] = FindFace(face_keys[0]);
+		}
+
+		for (auto const & key : edge_component.GetKeys())
+		{
+			if (key.Type() != HPS::Type::LineKey)
+				continue;
+
+			if (edge.line.Type() == HPS::Type::None)
+				edge.line = LineKey(key);
+			edge_lookup[key] = edges.size();
+		}
+
+		if (edge.line.Type() != HPS::Type::None)
+			edges.push_back(edge);
+	}
+}
+
+size_t Exchange::MeasurementOperator::TopologyCache::FindFace(Key const & in_shell_key) const
+{
+	auto it = face_lookup.find(in_shell_key);
+	if (it == face_lookup.end())
+		return InvalidIndex;
+	return it->second;
+}
+
+size_t Exchange::MeasurementOperator::TopologyCache::FindEdge(Key const & in_line_key) const
+{
+	auto it = edge_lookup.find(in_line_key);
+	if (it == edge_lookup.end())
+		return InvalidIndex;
+	return it->second;
+}
+
+Exchange::MeasurementOperator::TopologyCache & Exchange::MeasurementOperator::GetTopology()
+{
+	if (!topology.IsBuiltFor(cad_model))
+		topology.Build(cad_model);
+	return topology;
+}
+
+void Exchange::MeasurementOperator::GetCachedEdgeLengthAndType(size_t in_edge_index)
+{
+	TopologyCache::Edge & edge = topology.edges[in_edge_index];
+	if (!edge.length_computed)
+	{
+		edge_length = 0.0;
+		edge_type = EdgeType::Generic;
+		GetEdgeLengthAndType(edge.component);
+
+		edge.length = edge_length;
+		edge.type = edge_type;
+		if (edge_type == EdgeType::Circle)
+		{
+			edge.radius = radius;
+			edge.circle_center = circle_center;
+		}
+		edge.length_computed = true;
+		return;
+	}
+
+	edge_length = edge.length;
+	edge_type = edge.type;
+	if (edge_type == EdgeType::Circle)
+	{
+		radius = edge.radius;
+		circle_center = edge.circle_center;
+	}
+}
+
+void Exchange::MeasurementOperator::GetCachedSurfaceType(size_t in_face_index, Surface & out_surface)
+{
+	TopologyCache::Face & face = topology.faces[in_face_index];
+	if (!face.surface_computed)
+	{
+		Surface surface;
+		GetSurfaceType(face.component, surface);
+		face.surface_type = surface.surface_type;
+		face.center = surface.center;
+		face.normal = surface.normal;
+		face.surface_computed = true;
+	}
+
+	out_surface.surface_type = face.surface_type;
+	out_surface.center = face.center;
+	out_surface.normal = face.normal;
+}
+
+bool Exchange::MeasurementOperator::IsCachedPlane(size_t in_face_index)
+{
+	Surface surface;
+	GetCachedSurfaceType(in_face_index, surface);
+	return surface.surface_type == Surface::SurfaceType::Plane;
+}
+
+Vector Exchange::MeasurementOperator::GetCachedPlaneNormal(size_t in_face_index)
+{
+	TopologyCache::Face & face = topology.faces[in_face_index];
+	if (!face.plane_normal_computed)
+	{
+		VectorArray normals;
+		face.shell.ShowNetVertexNormalsByRange(0, 1, normals);
+		face.plane_normal = normals.empty() ? Vector::Zero() : normals[0];
+		face.plane_normal_computed = true;
+	}
+	return face.plane_normal;
+}
+
 Point Exchange::MeasurementOperator::GetPlaneIntersection(Plane const & in_plane, KeyPath const & in_key_path, WindowPoint const & in_window_point)
 {
 	//calculate the projection of the vector made by the world cursor position and the center on the circle plane
@@ -3257,8 +3398,7 @@ bool Exchange::MeasurementOperator::Highlight(MeasurementType in_measurement_typ
 		if (!check_selection())
 			return update_required;
 
-		HPS::Exchange::Component edge_component = cad_model.GetComponentPath(complete_path).Front();
-		if (edge_component.Empty() || edge_component.GetComponentType() != Component::ComponentType::ExchangeTopoEdge)
+		if (GetTopology().FindEdge(selected_key) == TopologyCache::InvalidIndex)
 			return update_required;
 	}
 	else if ((in_measurement_type == Exchange::MeasurementOperator::MeasurementType::FeatureToFeature ||
@@ -3287,36 +3427,36 @@ bool Exchange::MeasurementOperator::Highlight(MeasurementType in_measurement_typ
 		if (!check_selection())
 			return update_required;
 
-		auto component_path = cad_model.GetComponentPath(complete_path);
-		HPS::Exchange::Component face_component = component_path.Front();
-		if (face_component.Empty() || face_component.GetComponentType() != Component::ComponentType::ExchangeTopoFace)
-			return update_required;
-		
-		if (component_path == surface_one.path || component_path == surface_two.path)
+		size_t face_index = GetTopology().FindFace(selected_key);
+		if (face_index == TopologyCache::InvalidIndex)
 			return update_required;
 
+		if (!surface_one.path.Empty() || !surface_two.path.Empty())
+		{
+			auto component_path = cad_model.GetComponentPath(complete_path);
+			if (component_path == surface_one.path || component_path == surface_two.path)
+				return update_required;
+		}
+
 		if (in_measurement_type == Exchange::MeasurementOperator::MeasurementType::FeatureToFeature)
 		{
 			Surface temp_surface;
-			GetSurfaceType(face_component, temp_surface);
+			GetCachedSurfaceType(face_index, temp_surface);
 			if (temp_surface.surface_type == Surface::SurfaceType::Unsupported)
 				return update_required;
 		}
 		else
 		{
-			if (!IsPlane(face_component))
+			if (!IsCachedPlane(face_index))
 				return update_required;
 
 			if (anchors == 1)
 			{
-				ShellKey shell = (ShellKey)face_component.GetKeys()[0];
-				VectorArray normals;
-				shell.ShowNetVertexNormalsByRange(0, 1, normals);
 				HPS::KeyPath shell_path(selected_key + selection_path);
 				MatrixKit net_matrix;
 				shell_path.ShowNetModellingMatrix(net_matrix);
-				normals = net_matrix.Transform(normals);
-				float dot_product = fabs(first_face_normal.Dot(normals[0]));
+				Vector face_normal = net_matrix.Transform(GetCachedPlaneNormal(face_index));
+				float dot_product = fabs(first_face_normal.Dot(face_normal));
 				if (Float::Equals(dot_product, 1))
 					return update_required;
 			}
@@ -3372,3 +3512,287 @@ void HPS::Exchange::MeasurementOperator::DeleteLastMeasurement()
 	ResetMeasurement();
 	highlighted_path.Reset();
 }
+
+Exchange::MeasurementOperator::BatchMeasurement::BatchMeasurement()
+	: type(MeasurementType::FeatureToFeature)
+	, success(false)
+	, value(0.0f)
+	, is_radius(false)
+{
+}
+
+size_t HPS::Exchange::MeasurementOperator::MeasureBatch(std::vector<BatchMeasurement> & io_measurements, size_t in_worker_count)
+{
+	//distance computations which are deferred to the worker threads
+	struct TriangleJob
+	{
+		size_t					index;
+		PointArray				points_one;
+		IntArray				facelist_one;
+		PointArray				points_two;
+		IntArray				facelist_two;
+	};
+
+	struct CenterLineJob
+	{
+		size_t					index;
+		Point					line_one;
+		Point					line_two;
+		std::vector<PointArray>	edges;
+	};
+
+	std::vector<TriangleJob> triangle_jobs;
+	std::vector<CenterLineJob> center_line_jobs;
+
+	//the edge and surface functions report through the members used by interactive measurements
+	double saved_edge_length = edge_length;
+	EdgeType saved_edge_type = edge_type;
+	float saved_radius = radius;
+	Point saved_circle_center = circle_center;
+
+	TopologyCache & topology_cache = GetTopology();
+
+	auto find_face = [&](ComponentPath const & in_path)
+	{
+		if (!in_path.Empty())
+		{
+			for (auto const & key : in_path.Front().GetKeys())
+			{
+				size_t face_index = topology_cache.FindFace(key);
+				if (face_index != TopologyCache::InvalidIndex)
+					return face_index;
+			}
+		}
+		return TopologyCache::InvalidIndex;
+	};
+
+	auto find_edge = [&](ComponentPath const & in_path)
+	{
+		if (!in_path.Empty())
+		{
+			for (auto const & key : in_path.Front().GetKeys())
+			{
+				size_t edge_index = topology_cache.FindEdge(key);
+				if (edge_index != TopologyCache::InvalidIndex)
+					return edge_index;
+			}
+		}
+		return TopologyCache::InvalidIndex;
+	};
+
+	auto get_key_path = [](ComponentPath const & in_path, KeyPath & out_key_path)
+	{
+		KeyPathArray key_paths = in_path.GetKeyPaths();
+		if (key_paths.empty())
+			return false;
+		out_key_path = key_paths[0];
+		return true;
+	};
+
+	//resolve the topology on this thread, since Exchange queries are not thread-safe
+	for (size_t i = 0, e = io_measurements.size(); i < e; ++i)
+	{
+		BatchMeasurement & measurement = io_measurements[i];
+		measurement.success = false;
+		measurement.value = 0.0f;
+		measurement.is_radius = false;
+
+		KeyPath path_one;
+		KeyPath path_two;
+		MatrixKit matrix_one;
+		MatrixKit matrix_two;
+		if (!get_key_path(measurement.first, path_one))
+			continue;
+		path_one.ShowNetModellingMatrix(matrix_one);
+
+		if (measurement.type == MeasurementType::EdgeAndRadius)
+		{
+			size_t edge_index = find_edge(measurement.first);
+			if (edge_index == TopologyCache::InvalidIndex)
+				continue;
+
+			GetCachedEdgeLengthAndType(edge_index);
+			if (edge_type == EdgeType::Circle)
+			{
+				measurement.value = radius;
+				measurement.is_radius = true;
+				measurement.point_one = matrix_one.Transform(circle_center);
+				measurement.point_two = measurement.point_one;
+			}
+			else
+			{
+				PointArray points;
+				topology_cache.edges[edge_index].line.ShowPoints(points);
+				if (!points.empty())
+				{
+					measurement.point_one = matrix_one.Transform(points.front());
+					measurement.point_two = matrix_one.Transform(points.back());
+				}
+				measurement.value = (float)edge_length;
+			}
+			measurement.success = true;
+			continue;
+		}
+
+		if (measurement.type != MeasurementType::FeatureToFeature &&
+			measurement.type != MeasurementType::FaceAngle)
+			continue;
+
+		if (!get_key_path(measurement.second, path_two))
+			continue;
+		path_two.ShowNetModellingMatrix(matrix_two);
+
+		size_t face_one = find_face(measurement.first);
+		size_t face_two = find_face(measurement.second);
+		if (face_one == TopologyCache::InvalidIndex || face_two == TopologyCache::InvalidIndex)
+			continue;
+
+		if (measurement.type == MeasurementType::FaceAngle)
+		{
+			if (!IsCachedPlane(face_one) || !IsCachedPlane(face_two))
+				continue;
+
+			Vector normal_one = matrix_one.Transform(GetCachedPlaneNormal(face_one)).Normalize();
+			Vector normal_two = matrix_two.Transform(GetCachedPlaneNormal(face_two)).Normalize();
+			measurement.value = HPS::ACos(HPS::Clamp(normal_one.Dot(normal_two), -1.0f, 1.0f));
+			measurement.success = true;
+			continue;
+		}
+
+		Surface temp_surface_one;
+		Surface temp_surface_two;
+		GetCachedSurfaceType(face_one, temp_surface_one);
+		GetCachedSurfaceType(face_two, temp_surface_two);
+		if (temp_surface_one.surface_type == Surface::SurfaceType::Unsupported ||
+			temp_surface_two.surface_type == Surface::SurfaceType::Unsupported)
+			continue;
+
+		if (temp_surface_one.surface_type == Surface::SurfaceType::Plane &&
+			temp_surface_two.surface_type == Surface::SurfaceType::Plane)
+		{
+			TriangleJob job;
+			job.index = i;
+			ShellKey shell_one = topology_cache.faces[face_one].shell;
+			ShellKey shell_two = topology_cache.faces[face_two].shell;
+			shell_one.ShowPoints(job.points_one);
+			shell_one.ShowFacelist(job.facelist_one);
+			shell_two.ShowPoints(job.points_two);
+			shell_two.ShowFacelist(job.facelist_two);
+			job.points_one = matrix_one.Transform(job.points_one);
+			job.points_two = matrix_two.Transform(job.points_two);
+			triangle_jobs.push_back(std::move(job));
+		}
+		else if (temp_surface_one.surface_type == Surface::SurfaceType::ConeOrCylinder &&
+			temp_surface_two.surface_type == Surface::SurfaceType::ConeOrCylinder)
+		{
+			//the distance between two center lines is cheap enough to compute here
+			Point line_one_start, line_one_end, line_two_start, line_two_end;
+			GetCenterLine(temp_surface_one, path_one, line_one_start, line_one_end);
+			GetCenterLine(temp_surface_two, path_two, line_two_start, line_two_end);
+
+			LineKey no_geometry;
+			measurement.value = LineSegmentDistance(line_one_start, line_one_end, line_two_start, line_two_end, no_geometry, no_geometry, measurement.point_one, measurement.point_two, false);
+			measurement.success = true;
+		}
+		else
+		{
+			CenterLineJob job;
+			job.index = i;
+
+			bool first_is_plane = temp_surface_one.surface_type == Surface::SurfaceType::Plane;
+			size_t plane_face = first_is_plane ? face_one : face_two;
+			MatrixKit const & plane_matrix = first_is_plane ? matrix_one : matrix_two;
+			if (first_is_plane)
+				GetCenterLine(temp_surface_two, path_two, job.line_one, job.line_two);
+			else
+				GetCenterLine(temp_surface_one, path_one, job.line_one, job.line_two);
+
+			for (auto const & edge : topology_cache.faces[plane_face].component.GetAllSubcomponents(Component::ComponentType::ExchangeTopoEdge))
+			{
+				KeyArray edge_keys = edge.GetKeys();
+				if (edge_keys.empty())
+					continue;
+
+				size_t edge_index = topology_cache.FindEdge(edge_keys[0]);
+				if (edge_index == TopologyCache::InvalidIndex)
+					continue;
+
+				PointArray edge_points;
+				topology_cache.edges[edge_index].line.ShowPoints(edge_points);
+				if (edge_points.size() > 1)
+					job.edges.push_back(plane_matrix.Transform(edge_points));
+			}
+			center_line_jobs.push_back(std::move(job));
+		}
+	}
+
+	edge_length = saved_edge_length;
+	edge_type = saved_edge_type;
+	radius = saved_radius;
+	circle_center = saved_circle_center;
+
+	//the distance computations only read the data gathered above, and can run in parallel
+	size_t job_count = triangle_jobs.size() + center_line_jobs.size();
+	auto run_job = [&](size_t job)
+	{
+		if (job < triangle_jobs.size())
+		{
+			TriangleJob const & triangle_job = triangle_jobs[job];
+			BatchMeasurement & measurement = io_measurements[triangle_job.index];
+			float minimum_distance_squared = TriangleDistanceSquared(triangle_job.points_one, triangle_job.facelist_one, triangle_job.points_two, triangle_job.facelist_two, measurement.point_one, measurement.point_two);
+			measurement.value = sqrt(minimum_distance_squared);
+			measurement.success = !triangle_job.facelist_one.empty() && !triangle_job.facelist_two.empty();
+		}
+		else
+		{
+			CenterLineJob & center_line_job = center_line_jobs[job - triangle_jobs.size()];
+			BatchMeasurement & measurement = io_measurements[center_line_job.index];
+			float minimum_distance = (std::numeric_limits<float>::max)();
+			LineKey no_geometry;
+			for (auto & edge_points : center_line_job.edges)
+			{
+				for (size_t i = 0, e = edge_points.size() - 1; i < e; ++i)
+				{
+					Point point_on_center_line;
+					Point point_on_edge;
+					float distance = LineSegmentDistance(center_line_job.line_one, center_line_job.line_two, edge_points[i], edge_points[i + 1], no_geometry, no_geometry, point_on_edge, point_on_center_line);
+					if (distance < minimum_distance)
+					{
+						minimum_distance = distance;
+						measurement.point_one = point_on_edge;
+						measurement.point_two = point_on_center_line;
+					}
+				}
+			}
+			measurement.value = minimum_distance;
+			measurement.success = !center_line_job.edges.empty();
+		}
+	};
+
+	size_t worker_count = in_worker_count;
+	if (worker_count == 0)
+		worker_count = (std::max)(static_cast<size_t>(std::thread::hardware_concurrency()), static_cast<size_t>(1));
+	worker_count = (std::min)(worker_count, job_count);
+
+	std::atomic<size_t> next_job(0);
+	auto worker = [&]()
+	{
+		for (size_t job = next_job++; job < job_count; job = next_job++)
+			run_job(job);
+	};
+
+	std::vector<std::thread> workers;
+	for (size_t i = 1; i < worker_count; ++i)
+		workers.emplace_back(worker);
+	worker();
+	for (auto & one_worker : workers)
+		one_worker.join();
+
+	size_t successful_measurements = 0;
+	for (auto const & measurement : io_measurements)
+	{
+		if (measurement.success)
+			++successful_measurements;
+	}
+	return successful_measurements;
+}
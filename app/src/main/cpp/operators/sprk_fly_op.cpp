@@ -36,8 +36,9 @@ void HPS::FlyOperator::OnViewAttached(HPS::View const & in_attached_view)
 	view_segment.GetDrawingAttributeControl().ShowWorldHandedness(world_handedness);
 }
 
-void HPS::FlyOperator::OnViewDetached(HPS::View const &)
+void HPS::FlyOperator::OnViewDetached(HPS::View const & in_detached_view)
 {
+	InteractionLOD::EndInteraction(in_detached_view);
     if (left_joystick_segment.Type() != HPS::Type::None)
         left_joystick_segment.Delete();
     if (right_joystick_segment.Type() != HPS::Type::None)
@@ -119,6 +120,7 @@ bool HPS::FlyOperator::OnMouseWheel(MouseState const & in_state)
 
 		camera.SetField(width, height);
 		GetAttachedView().GetSegmentKey().SetCamera(camera);
+		InteractionLOD::BeginInteraction(GetAttachedView());
 		Database::GetEventDispatcher().InjectEvent(CameraChangedEvent(GetAttachedView()));
 		GetAttachedView().Update();
 	}
@@ -483,9 +485,12 @@ bool HPS::FlyOperator::OnTimerTick(HPS::TimerTickEvent const & in_event)
 
 	if (movement_flags)
 	{
+		InteractionLOD::BeginInteraction(view);
 		Database::GetEventDispatcher().InjectEvent(CameraChangedEvent(view));
 		view.Update();
 	}
+	else if (InteractionLOD::Tick(view))
+		view.Update();
 
 	if (restore_length)
 	{
@@ -596,16 +601,9 @@ void HPS::FlyOperator::UpdateKeyboardState(KeyboardState const & in_state)
 
 float HPS::FlyOperator::CalculateSceneExtents()
 {
-	SegmentKey bounding_segment;
-	Model model = GetAttachedView().GetAttachedModel();
-	if (model.Type() == HPS::Type::None)
-		bounding_segment = GetAttachedView().GetSegmentKey();
-	else
-		bounding_segment = model.GetSegmentKey();
-
 	SimpleSphere bounding_sphere;
 	SimpleCuboid bounding_cuboid;
-	if (!bounding_segment.GetBoundingControl().ShowVolume(bounding_sphere, bounding_cuboid))
+	if (!BoundingCache::ShowVolume(GetAttachedView(), bounding_sphere, bounding_cuboid))
 	{
 		bounding_cuboid.min = HPS::Point(-0.1f, -0.1f, -0.1f);
 		bounding_cuboid.max = HPS::Point(0.1f, 0.1f, 0.1f);
@@ -31,6 +31,8 @@ HandlesOperator::HandlesOperator(MouseButtons in_mouse_trigger, ModifierKeys in_
 	, display_trailing_geometry(true)
 	, rotation_direction(0.0f)
 	, cad_model_type(HPS::Type::None)
+	, reference_matrix_valid(false)
+	, has_accumulated_transform(false)
 {
 	for (size_t i = 0; i <= InternalHandleType::last; ++i)
 	{
@@ -311,6 +313,14 @@ bool HandlesOperator::InputDown(size_t in_click_count, WindowKey const & in_wind
 				{
 					last_attached_view.GetSegmentKey().GetCameraControl().ShowProjection(camera_projection);
 
+					//the camera does not change while a handle is dragged, cache what InputMove needs
+					MatrixKit window_to_world_matrix;
+					window_to_world.clear();
+					if (KeyPath(in_event_path).ComputeTransform(Coordinate::Space::Window, Coordinate::Space::World, window_to_world_matrix))
+						window_to_world_matrix.ShowElements(window_to_world);
+					handles_matrix = MatrixKit::GetDefault();
+					handles_segment.ShowModellingMatrix(handles_matrix);
+
 					remove_handles = false;
 					it.GetItem().ShowSelectionPosition(movement_start_point);
 
@@ -524,11 +534,10 @@ bool HandlesOperator::InputMove(KeyPath const & in_path, Point const & in_locati
 		point_two.z = 10000;
 	}
 
-	in_path.ConvertCoordinate(Coordinate::Space::Window, point_one, Coordinate::Space::World, point_one);
-	in_path.ConvertCoordinate(Coordinate::Space::Window, point_two, Coordinate::Space::World, point_two);
+	point_one = WindowToWorld(in_path, point_one);
+	point_two = WindowToWorld(in_path, point_two);
 
-	MatrixKit handles_xform = MatrixKit::GetDefault();
-	handles_segment.ShowModellingMatrix(handles_xform);
+	MatrixKit const handles_xform = handles_matrix;
 	Vector transformed_movement_direction = movement_direction;
 	transformed_movement_direction = handles_xform.Transform(movement_direction);
 
@@ -565,6 +574,7 @@ bool HandlesOperator::InputMove(KeyPath const & in_path, Point const & in_locati
 
 		//move the handles
 		handles_segment.GetModellingMatrixControl().Translate(displacement_vector.x, displacement_vector.y, displacement_vector.z);
+		handles_matrix.Translate(displacement_vector.x, displacement_vector.y, displacement_vector.z);
 
 		trailing_circle_center += displacement_vector;
 		if (display_trailing_geometry)
@@ -595,26 +605,7 @@ bool HandlesOperator::InputMove(KeyPath const & in_path, Point const & in_locati
 		}
 
 		//move the geometry
-		MatrixKit matrix;
-		if (reference_segment.ShowModellingMatrix(matrix))
-		{
-			matrix = matrix.Invert();
-			displacement_vector = matrix.Transform(displacement_vector);
-
-			//take scaling into account
-			FloatArray elements;
-			if (matrix.ShowElements(elements))
-			{
-				Vector x_scale = Vector(elements[0], elements[1], elements[2]);
-				Vector y_scale = Vector(elements[4], elements[5], elements[6]);
-				Vector z_scale = Vector(elements[8], elements[9], elements[10]);
-
-				displacement_vector.x *= (float)x_scale.LengthSquared();
-				displacement_vector.y *= (float)y_scale.LengthSquared();
-				displacement_vector.z *= (float)z_scale.LengthSquared();
-			}
-		}
-		temporary_segment_to_move.GetModellingMatrixControl().Translate(displacement_vector.x, displacement_vector.y, displacement_vector.z);
+		TranslateGeometry(displacement_vector);
 
 		movement_start_point = intersection_point;
 
@@ -626,6 +617,7 @@ bool HandlesOperator::InputMove(KeyPath const & in_path, Point const & in_locati
 
 		//move the handles
 		handles_segment.GetModellingMatrixControl().Translate(movement.x, movement.y, movement.z);
+		handles_matrix.Translate(movement.x, movement.y, movement.z);
 
 		//update trailing geometry
 		trailing_circle.Delete();
@@ -648,26 +640,7 @@ bool HandlesOperator::InputMove(KeyPath const & in_path, Point const & in_locati
 		trailing_rotation = Vector::Zero();
 
 		//move the geometry
-		MatrixKit matrix;
-		if (reference_segment.ShowModellingMatrix(matrix))
-		{
-			matrix = matrix.Invert();
-			movement = matrix.Transform(movement);
-
-			//take scaling into account
-			FloatArray elements;
-			if (matrix.ShowElements(elements))
-			{
-				Vector x_scale = Vector(elements[0], elements[1], elements[2]);
-				Vector y_scale = Vector(elements[4], elements[5], elements[6]);
-				Vector z_scale = Vector(elements[8], elements[9], elements[10]);
-
-				movement.x *= (float)x_scale.LengthSquared();
-				movement.y *= (float)y_scale.LengthSquared();
-				movement.z *= (float)z_scale.LengthSquared();
-			}
-		}
-		temporary_segment_to_move.GetModellingMatrixControl().Translate(movement.x, movement.y, movement.z);
+		TranslateGeometry(movement);
 
 		movement_start_point = intersection_point;
 
@@ -698,6 +671,7 @@ bool HandlesOperator::InputMove(KeyPath const & in_path, Point const & in_locati
 		matrix.RotateOffAxis(transformed_movement_direction, angle);
 		matrix.Translate(handles_translation.x, handles_translation.y, handles_translation.z);
 		handles_segment.GetModellingMatrixControl().Concatenate(matrix);
+		handles_matrix.Concatenate(matrix);
 
 		if (display_trailing_geometry)
 		{
@@ -765,11 +739,10 @@ bool HandlesOperator::InputMove(KeyPath const & in_path, Point const & in_locati
 		}
 
 		//move the geometry
-		MatrixKit ref_matrix;
-		if (reference_segment.ShowModellingMatrix(ref_matrix))
+		if (reference_matrix_valid)
 		{
 			matrix = MatrixKit::GetDefault();
-			MatrixKit inv_ref_matrix = ref_matrix.Invert();
+			MatrixKit const & inv_ref_matrix = inverse_reference_matrix;
 
 			Point displacement(handles_translation.x, handles_translation.y, handles_translation.z);
 			displacement = inv_ref_matrix.Transform(displacement);
@@ -780,6 +753,8 @@ bool HandlesOperator::InputMove(KeyPath const & in_path, Point const & in_locati
 			matrix.Translate(displacement.x, displacement.y, displacement.z);
 		}
 		temporary_segment_to_move.GetModellingMatrixControl().Concatenate(matrix);
+		accumulated_transform.Concatenate(matrix);
+		has_accumulated_transform = true;
 
 		movement_start_point = intersection_point;
 
@@ -832,10 +807,15 @@ void HandlesOperator::InputUp(Point const & in_location)
 		}
 		
 		handles_trail.GetVisibilityControl().SetEverything(false);
+		BoundingCache::Invalidate(last_attached_view.GetAttachedModel());
+		SelectionCache::Invalidate(last_attached_view.GetAttachedModel());
+		PickingIndex::Invalidate(last_attached_view.GetAttachedModel());
+		WalkOperator::InvalidateTerrain(last_attached_view.GetAttachedModel());
 		last_attached_view.Update();
 	}
 
 	move_geometry = Movement::None;
+	window_to_world.clear();
 }
 
 bool HandlesOperator::HighlightHandles(WindowKey & in_window, KeyArray const & in_event_path, Point const & in_location)
@@ -1170,9 +1150,23 @@ void HandlesOperator::ReferenceGeometry(KeyPath const & in_path)
 		contains_polygons = true;
 
 	MatrixKit net_modelling_matrix;
-	if (trimmed_path.ShowNetModellingMatrix(net_modelling_matrix))
+	reference_matrix_valid = trimmed_path.ShowNetModellingMatrix(net_modelling_matrix);
+	if (reference_matrix_valid)
+	{
 		reference_segment.SetModellingMatrix(net_modelling_matrix);
 
+		//the geometry is moved in the coordinate system of reference_segment
+		inverse_reference_matrix = MatrixKit(net_modelling_matrix).Invert();
+		reference_scale = Vector(1, 1, 1);
+		FloatArray elements;
+		if (inverse_reference_matrix.ShowElements(elements))
+		{
+			reference_scale.x = (float)Vector(elements[0], elements[1], elements[2]).LengthSquared();
+			reference_scale.y = (float)Vector(elements[4], elements[5], elements[6]).LengthSquared();
+			reference_scale.z = (float)Vector(elements[8], elements[9], elements[10]).LengthSquared();
+		}
+	}
+
 	VisibilityKit net_visibility;
 	if (trimmed_path.ShowNetVisibility(net_visibility))
 		reference_segment.SetVisibility(net_visibility);
@@ -1234,6 +1228,107 @@ void HandlesOperator::ReferenceGeometry(KeyPath const & in_path)
 
 	temporary_segment_to_move = reference_segment.Subsegment("HPS_handles_temporary_segment");
 	temporary_segment_to_move.IncludeSegment(segment_to_move);
+	accumulated_transform = MatrixKit::GetDefault();
+	has_accumulated_transform = false;
+
+	AnalyzeIncludes();
+}
+
+Point HandlesOperator::WindowToWorld(KeyPath const & in_path, Point const & in_window_point) const
+{
+	if (window_to_world.size() != 16)
+	{
+		Point world_point;
+		in_path.ConvertCoordinate(Coordinate::Space::Window, in_window_point, Coordinate::Space::World, world_point);
+		return world_point;
+	}
+
+	//the window to world matrix is projective when the camera is in perspective, so apply the homogeneous divide
+	float const * m = window_to_world.data();
+	float const x = in_window_point.x, y = in_window_point.y, z = in_window_point.z;
+	float w = x * m[3] + y * m[7] + z * m[11] + m[15];
+	if (w == 0.0f)
+		w = 1.0f;
+	return Point((x * m[0] + y * m[4] + z * m[8] + m[12]) / w,
+				 (x * m[1] + y * m[5] + z * m[9] + m[13]) / w,
+				 (x * m[2] + y * m[6] + z * m[10] + m[14]) / w);
+}
+
+void HandlesOperator::TranslateGeometry(Vector const & in_world_displacement)
+{
+	Vector displacement = in_world_displacement;
+	if (reference_matrix_valid)
+	{
+		displacement = inverse_reference_matrix.Transform(displacement);
+
+		//take scaling into account
+		displacement.x *= reference_scale.x;
+		displacement.y *= reference_scale.y;
+		displacement.z *= reference_scale.z;
+	}
+	temporary_segment_to_move.GetModellingMatrixControl().Translate(displacement.x, displacement.y, displacement.z);
+	accumulated_transform.Translate(displacement.x, displacement.y, displacement.z);
+	has_accumulated_transform = true;
+}
+
+void HandlesOperator::AnalyzeIncludes()
+{
+	include_analysis = IncludeAnalysis();
+	if (cad_model_type == HPS::Type::ExchangeCADModel || cad_model_type == HPS::Type::ParasolidCADModel)
+		return;
+
+	/* Start with the segment that we are trying to move. This will always be included in at least
+	 * one more segment, since the operator includes segment_to_move somewhere above the static tree
+	 * For this reason, for this segment alone we check whether it is included more than twice. */
+	include_analysis.minimum_number_of_includes = 1;
+	if (path_to_segment_to_move.At(0).Type() == HPS::Type::IncludeKey)
+		include_analysis.minimum_number_of_includes = 2;
+
+	//Show the includes used for the segment we moved
+	include_analysis.includers = segment_to_move.ShowIncluders(include_analysis.includes);
+
+	include_analysis.including_segments.resize(include_analysis.includes.size());
+	for (size_t i = 0; i < include_analysis.includes.size(); ++i)
+		include_analysis.including_segments[i] = include_analysis.includes[i].Owner();
+
+	//Check if the segment we are trying to move is included into one of the segments along its path
+	//If this is the case we will need to break this include
+	SegmentKey model_segment = last_attached_view.GetAttachedModel().GetSegmentKey();
+	for (auto const & one_key : path_to_segment_to_move)
+	{
+		if (one_key.Type() == HPS::Type::SegmentKey)
+		{
+			HPS::SegmentKey one_segment(one_key);
+			if (one_segment == model_segment)
+				break;
+
+			if (std::find(include_analysis.including_segments.begin(), include_analysis.including_segments.end(), one_segment) != include_analysis.including_segments.end())
+			{
+				include_analysis.included_along_path = true;
+				break;
+			}
+		}
+	}
+
+	//Check to see if the segment we want to move is included somewhere, and if
+	//its parent segments are also included from somewhere.
+	//If we have a chain of includes we have to break all of them, in this case
+	//we mark segment_to_move as having multiple_includes
+	for (auto const & one_key : path_to_segment_to_move)
+	{
+		if (one_key == model_segment)
+			break;
+		else if (one_key.Type() == HPS::Type::SegmentKey)
+		{
+			SegmentKey one_segment(one_key);
+			SegmentKeyArray key_includers;
+			if (one_segment.ShowIncluders(key_includers) > 1)
+			{
+				include_analysis.multiple_includes = true;
+				break;
+			}
+		}
+	}
 }
 
 void HandlesOperator::CommitChanges()
@@ -1254,73 +1349,23 @@ void HandlesOperator::CommitChanges()
 
 	try
 	{
-		MatrixKit matrix;
-		if (temporary_segment_to_move.ShowModellingMatrix(matrix))
+		if (has_accumulated_transform)
 		{
+			MatrixKit const & matrix = accumulated_transform;
 			if (cad_model_type != HPS::Type::ExchangeCADModel &&
 				cad_model_type != HPS::Type::ParasolidCADModel)
 			{
 				/* If the segment we want to move, or one of its parents, is included in multiple places,
 				 * we need to make a copy of it and flatten out the subtree that needs to be moved.
 				 * this is done because otherwise all pieces of geometry from that include will also be transformed.
-				 * NOTE: If you are operating on components, this will BREAK the component structure. */
-				bool multiple_includes = false;
-
-				/* Start with the segment that we are trying to move. This will always be included in at least
-				 * one more segment, since the operator includes segment_to_move somewhere above the static tree
-				 * For this reason, for this segment alone we check whether it is included more than twice. */
-				size_t minimum_number_of_includes = 1;
-				if (path_to_segment_to_move.At(0).Type() == HPS::Type::IncludeKey)
-					minimum_number_of_includes = 2;
-
-				//Show the includes used for the segment we moved
-				HPS::IncludeKeyArray includes;
-				size_t includers = segment_to_move.ShowIncluders(includes);
-
-				SegmentKeyArray segments_which_include_segment_to_move;
-				segments_which_include_segment_to_move.resize(includes.size());
-				for (size_t i = 0; i < includes.size(); ++i)
-					segments_which_include_segment_to_move[i] = includes[i].Owner();
-
-				//Check if the segment we are trying to move is included into one of the segments along its path
-				//If this is the case we will need to break this include
-				bool included_along_path = false;
-				SegmentKey model_segment = last_attached_view.GetAttachedModel().GetSegmentKey();
-				for (auto const & one_key : path_to_segment_to_move)
-				{
-					if (one_key.Type() == HPS::Type::SegmentKey)
-					{
-						HPS::SegmentKey one_segment(one_key);
-						if (one_segment == model_segment)
-							break;
-
-						if (std::find(segments_which_include_segment_to_move.begin(), segments_which_include_segment_to_move.end(), one_segment) != segments_which_include_segment_to_move.end())
-						{
-							included_along_path = true;
-							break;
-						}
-					}
-				}
-
-				//Check to see if the segment we want to move is included somewhere, and if
-				//its parent segments are also included from somewhere.
-				//If we have a chain of includes we have to break all of them, in this case
-				//we mark segment_to_move as having multiple_includes
-				for (auto const & one_key : path_to_segment_to_move)
-				{
-					if (one_key == model_segment)
-						break;
-					else if (one_key.Type() == HPS::Type::SegmentKey)
-					{
-						SegmentKey one_segment(one_key);
-						SegmentKeyArray key_includers;
-						if (one_segment.ShowIncluders(key_includers) > 1)
-						{
-							multiple_includes = true;
-							break;
-						}
-					}
-				}
+				 * NOTE: If you are operating on components, this will BREAK the component structure.
+				 * The includes were analyzed when the handles were inserted, see AnalyzeIncludes. */
+				bool const multiple_includes = include_analysis.multiple_includes;
+				bool const included_along_path = include_analysis.included_along_path;
+				size_t const minimum_number_of_includes = include_analysis.minimum_number_of_includes;
+				size_t const includers = include_analysis.includers;
+				HPS::IncludeKeyArray & includes = include_analysis.includes;
+				SegmentKeyArray const & segments_which_include_segment_to_move = include_analysis.including_segments;
 
 				//Simple case:
 				//Either segment_to_move is included in other places, or is an include itself, but its parent segments are not included from somewhere
@@ -24,42 +24,30 @@ void HPS::HighlightAreaOperator::OnViewAttached(HPS::View const & in_attached_vi
 
 bool HPS::HighlightAreaOperator::OnMouseUp(MouseState const  & in_state)
 {
-	if(!SelectAreaOperator::OnMouseUp(in_state))
-		return false;
-
-	HPS::WindowKey window = in_state.GetEventSource();
-	return HighlightCommon(window, in_state.GetModifierKeys());
+	//the results are highlighted batch by batch as they come in, see OnSelectionBatch
+	return SelectAreaOperator::OnMouseUp(in_state);
 }
 
 bool HPS::HighlightAreaOperator::OnTouchUp(TouchState const  & in_state)
 {
-	if(!SelectAreaOperator::OnTouchUp(in_state))
-		return false;
-
-	HPS::WindowKey window = in_state.GetEventSource();
-	return HighlightCommon(window, in_state.GetModifierKeys());
+	return SelectAreaOperator::OnTouchUp(in_state);
 }
 
-bool HPS::HighlightAreaOperator::HighlightCommon(WindowKey & in_window, ModifierKeys in_modifiers)
+void HPS::HighlightAreaOperator::OnSelectionStart(HPS::WindowKey const & in_window, HPS::ModifierKeys in_modifiers)
 {
-	HPS::SelectionResults results = GetActiveSelection();
-	size_t selected = results.GetCount();
-
 	if (!in_modifiers.Control())
 	{
-		in_window.GetHighlightControl().Unhighlight(highlight_options);
+		HPS::WindowKey window = in_window;
+		window.GetHighlightControl().Unhighlight(highlight_options);
 		HPS::Database::GetEventDispatcher().InjectEvent(HPS::HighlightEvent(HPS::HighlightEvent::Action::Unhighlight));
 	}
+}
 
-	if (selected > 0)
-	{
-		in_window.GetHighlightControl().Highlight(results, highlight_options);
-		HPS::Database::GetEventDispatcher().InjectEvent(HPS::HighlightEvent(HPS::HighlightEvent::Action::Highlight, results, highlight_options));
-	}
-
-	GetAttachedView().Update();
-
-	return true;
+void HPS::HighlightAreaOperator::OnSelectionBatch(HPS::WindowKey const & in_window, HPS::SelectionResults const & in_batch)
+{
+	HPS::WindowKey window = in_window;
+	window.GetHighlightControl().Highlight(in_batch, highlight_options);
+	HPS::Database::GetEventDispatcher().InjectEvent(HPS::HighlightEvent(HPS::HighlightEvent::Action::Highlight, in_batch, highlight_options));
 }
 
 
@@ -11,7 +11,7 @@
 
 
 HPS::HighlightOperator::HighlightOperator(MouseButtons in_mouse_trigger, ModifierKeys in_modifier_trigger)
-	: SelectOperator(in_mouse_trigger, in_modifier_trigger), highlight_options(HighlightOptionsKit::GetDefault())
+	: SelectOperator(in_mouse_trigger, in_modifier_trigger), highlight_options(HighlightOptionsKit::GetDefault()), highlighted_valid(false)
 {
 	highlight_options.SetStyleName("highlight_style");
 	highlight_options.SetOverlay(HPS::Drawing::Overlay::InPlace);
@@ -40,20 +40,96 @@ bool HPS::HighlightOperator::HighlightCommon(HPS::WindowKey & in_window, HPS::Mo
 {
 	HPS_UNREFERENCED(in_modifiers);
 	HPS::SelectionResults results = GetActiveSelection();
-	size_t selected = results.GetCount();
+	HPS::HighlightControl highlight_control = in_window.GetHighlightControl();
 
-	in_window.GetHighlightControl().UnhighlightEverything();
-	HPS::Database::GetEventDispatcher().InjectEvent(HPS::HighlightEvent(HPS::HighlightEvent::Action::Unhighlight));
+	//tapping on nothing clears all highlights, and the highlights cannot be diffed against a state we no longer know
+	if (!highlighted_valid || results.GetCount() == 0 || !HighlightsIntact(highlight_control))
+	{
+		HighlightAll(highlight_control, results);
+		GetAttachedView().Update();
+		return true;
+	}
 
-	if (selected > 0)
+	//only touch the items which changed since the last tap
+	HPS::SelectionResults removed;
+	removed.Copy(highlighted);
+	HPS::SelectionResults added;
+	added.Copy(results);
+	if (highlighted.GetCount() > 0 && (!removed.Difference(results) || !added.Difference(highlighted)))
 	{
-		in_window.GetHighlightControl().Highlight(results, highlight_options);
-		HPS::Database::GetEventDispatcher().InjectEvent(HPS::HighlightEvent(HPS::HighlightEvent::Action::Highlight, results, highlight_options));
+		//the selections were made at different levels
+		HighlightAll(highlight_control, results);
+		GetAttachedView().Update();
+		return true;
 	}
 
-	GetAttachedView().Update();
+	if (removed.GetCount() > 0)
+	{
+		highlight_control.Unhighlight(removed, highlight_options);
+		HPS::Database::GetEventDispatcher().InjectEvent(HPS::HighlightEvent(HPS::HighlightEvent::Action::Unhighlight, removed, highlight_options));
+	}
+
+	if (added.GetCount() > 0)
+	{
+		highlight_control.Highlight(added, highlight_options);
+		HPS::Database::GetEventDispatcher().InjectEvent(HPS::HighlightEvent(HPS::HighlightEvent::Action::Highlight, added, highlight_options));
+	}
+
+	highlighted.Copy(results);
+
+	if (removed.GetCount() > 0 || added.GetCount() > 0)
+		GetAttachedView().Update();
 
 	return true;
 }
 
+void HPS::HighlightOperator::HighlightAll(HPS::HighlightControl & in_highlight_control, HPS::SelectionResults const & in_results)
+{
+	in_highlight_control.UnhighlightEverything();
+	HPS::Database::GetEventDispatcher().InjectEvent(HPS::HighlightEvent(HPS::HighlightEvent::Action::Unhighlight));
+
+	if (in_results.GetCount() > 0)
+	{
+		in_highlight_control.Highlight(in_results, highlight_options);
+		HPS::Database::GetEventDispatcher().InjectEvent(HPS::HighlightEvent(HPS::HighlightEvent::Action::Highlight, in_results, highlight_options));
+	}
+
+	highlighted = HPS::SelectionResults();
+	highlighted.Copy(in_results);
+	highlighted_valid = true;
+}
+
+bool HPS::HighlightOperator::HighlightsIntact(HPS::HighlightControl const & in_highlight_control) const
+{
+	//someone else may have cleared or changed the highlights since the last tap, so ask the window rather than trust what we remember
+	HPS::KeyPathArray paths;
+	paths.reserve(highlighted.GetCount());
+	HPS::SelectionResultsIterator it = highlighted.GetIterator();
+	while (it.IsValid())
+	{
+		HPS::KeyPath path;
+		if (!it.GetItem().ShowPath(path))
+			return false;
+		paths.push_back(path);
+		it.Next();
+	}
+	if (paths.empty())
+		return true;
+
+	UTF8 style_name;
+	HPS::Drawing::Overlay overlay;
+	HPS::HighlightSearchOptionsKit search_options;
+	if (highlight_options.ShowStyleName(style_name))
+		search_options.SetStyleName(style_name);
+	if (highlight_options.ShowOverlay(overlay))
+		search_options.SetOverlay(overlay);
 
+	HPS::HighlightStateArray states;
+	in_highlight_control.ShowHighlightStates(paths, search_options, states);
+	for (auto const & state : states)
+	{
+		if (!state.GetDirectlyHighlighted() && !state.GetSubentityHighlighted())
+			return false;
+	}
+	return true;
+}
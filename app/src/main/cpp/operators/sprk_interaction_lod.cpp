@@ -0,0 +1,706 @@
+// Copyright (c) Tech Soft 3D, Inc.
+//
+// The information contained herein is confidential and proprietary to Tech Soft 3D, Inc.,
+// and considered a trade secret as defined under civil and criminal statutes.
+// Tech Soft 3D, Inc. shall pursue its civil and criminal remedies in the event of
+// unauthorized use or misappropriation of its trade secrets.  Use of this information
+// by anyone other than authorized employees of Tech Soft 3D, Inc. is granted only under
+// a written non-disclosure agreement, expressly prescribing the scope and manner of such use.
+
+#include "sprk_ops.h"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+
+using namespace HPS;
+
+namespace
+{
+	char const * const proxy_segment_name = "hps_lod_proxy";
+	char const * const interaction_condition = "hps_lod_interaction";
+	char const * const detail_hidden_style = "hps_lod_detail_hidden";
+	char const * const proxy_hidden_style = "hps_lod_proxy_hidden";
+	char const * const proxy_shown_style = "hps_lod_proxy_shown";
+
+	//each level of the proxies keeps this fraction of the triangles of the original shells
+	const size_t level_count = 3;
+	const float level_ratios[level_count] = { 0.25f, 0.0625f, 0.015625f };
+	char const * const level_conditions[level_count] = { "hps_lod_level_1", "hps_lod_level_2", "hps_lod_level_3" };
+	char const * const level_segment_names[level_count] = { "level_1", "level_2", "level_3" };
+
+	//segments with fewer triangles than this are drawn at full detail during interaction
+	const size_t minimum_segment_triangles = 2000;
+	//segments whose diagonal is smaller than this fraction of the model diagonal are drawn as boxes during interaction
+	const float tiny_segment_ratio = 0.005f;
+	const size_t box_triangles = 12;
+
+	typedef std::chrono::steady_clock Clock;
+
+	struct Leaf
+	{
+		SegmentKey			segment;
+		size_t				triangle_count;
+		SimpleCuboid		local_cuboid;
+		float				model_diagonal;		//diagonal of the segment in model space
+	};
+
+	struct LeafProxy
+	{
+		SegmentKey					segment;
+		bool						box;
+		SimpleCuboid				cuboid;
+		MeshDecimator::LevelArray	levels;
+	};
+
+	struct ProxyBuild
+	{
+		std::vector<LeafProxy>		leaves;
+		size_t						level_triangles[level_count];	//triangles drawn during interaction at each level, including the segments left as they are
+	};
+
+	struct ModelProxies
+	{
+		Model				model;
+		SegmentKey			style_sources;
+		SegmentKeyArray		proxies;
+		std::vector<StyleKey>	detail_styles;
+		size_t				level;
+		size_t				minimum_triangle_count;
+	};
+
+	//models whose proxies were released to save memory, generated again when the model is next interacted with
+	struct StaleModel
+	{
+		Model				model;
+		size_t				minimum_triangle_count;
+	};
+
+	struct Interaction
+	{
+		Clock::time_point	last_move;
+		size_t				level;
+	};
+
+	struct LODState
+	{
+		LODState() : idle_delay(0.3f), triangle_budget(1000000) {}
+
+		~LODState()
+		{
+			if (cancel)
+				*cancel = true;
+			if (builder.joinable())
+				builder.join();
+		}
+
+		std::mutex											mutex;
+		std::unordered_map<Key, ModelProxies, KeyHasher>	models;
+		std::unordered_map<Key, Interaction, KeyHasher>		interactions;
+		std::unordered_map<Key, StaleModel, KeyHasher>		stale;
+		float												idle_delay;
+		size_t												triangle_budget;
+		std::thread											builder;
+		Key													building;
+		StaleModel											building_model;		//what to generate again if the build is released
+		std::shared_ptr<std::atomic<bool>>					cancel;
+	};
+
+	LODState & GetLODState()
+	{
+		static LODState lod_state;
+		return lod_state;
+	}
+
+	size_t CountTriangles(IntArray const & in_facelist)
+	{
+		size_t count = 0;
+		size_t i = 0;
+		while (i < in_facelist.size())
+		{
+			int const face_count = in_facelist[i++];
+			if (face_count > 2)
+				count += static_cast<size_t>(face_count - 2);
+			i += static_cast<size_t>(face_count < 0 ? -face_count : face_count);
+		}
+		return count;
+	}
+
+	void Merge(SimpleCuboid & io_cuboid, bool & io_valid, Point const & in_point)
+	{
+		if (!io_valid)
+		{
+			io_cuboid = SimpleCuboid(in_point, in_point);
+			io_valid = true;
+			return;
+		}
+		io_cuboid.min.x = (std::min)(io_cuboid.min.x, in_point.x);
+		io_cuboid.min.y = (std::min)(io_cuboid.min.y, in_point.y);
+		io_cuboid.min.z = (std::min)(io_cuboid.min.z, in_point.z);
+		io_cuboid.max.x = (std::max)(io_cuboid.max.x, in_point.x);
+		io_cuboid.max.y = (std::max)(io_cuboid.max.y, in_point.y);
+		io_cuboid.max.z = (std::max)(io_cuboid.max.z, in_point.z);
+	}
+
+	float Diagonal(SimpleCuboid const & in_cuboid)
+	{
+		return static_cast<float>(Vector(in_cuboid.max - in_cuboid.min).Length());
+	}
+
+	//only segments without subsegments or includes get proxies: hiding a segment with a style hides everything below it too
+	void CollectLeaves(SegmentKey const & in_segment, MatrixKit const & in_parent_matrix, std::unordered_set<Key, KeyHasher> & io_visited,
+					   std::vector<Leaf> & io_leaves, size_t & io_triangle_count, SimpleCuboid & io_model_cuboid, bool & io_model_cuboid_valid)
+	{
+		if (!io_visited.insert(in_segment).second)
+			return;
+
+		MatrixKit matrix = in_parent_matrix;
+		MatrixKit local_matrix;
+		if (in_segment.ShowModellingMatrix(local_matrix))
+			matrix = local_matrix.Multiply(in_parent_matrix);
+
+		SegmentKeyArray children;
+		in_segment.ShowSubsegments(children);
+		children.erase(std::remove_if(children.begin(), children.end(), [](SegmentKey const & in_child) { return InteractionLOD::IsProxySegment(in_child); }), children.end());
+		for (auto const & child : children)
+			CollectLeaves(child, matrix, io_visited, io_leaves, io_triangle_count, io_model_cuboid, io_model_cuboid_valid);
+
+		SearchResults results;
+		if (in_segment.Find(Search::Type::Include, Search::Space::SegmentOnly, results) > 0)
+		{
+			auto it = results.GetIterator();
+			while (it.IsValid())
+			{
+				CollectLeaves(IncludeKey(it.GetItem()).GetTarget(), matrix, io_visited, io_leaves, io_triangle_count, io_model_cuboid, io_model_cuboid_valid);
+				it.Next();
+			}
+		}
+		bool const is_leaf = children.empty() && results.GetCount() == 0;
+
+		if (in_segment.Find(Search::Type::Shell, Search::Space::SegmentOnly, results) == 0)
+			return;
+
+		Leaf leaf;
+		leaf.segment = in_segment;
+		leaf.triangle_count = 0;
+		bool local_valid = false, model_valid = false;
+		SimpleCuboid model_cuboid;
+		auto it = results.GetIterator();
+		while (it.IsValid())
+		{
+			ShellKey shell(it.GetItem());
+			PointArray points;
+			IntArray facelist;
+			if (shell.ShowPoints(points) && shell.ShowFacelist(facelist))
+			{
+				leaf.triangle_count += CountTriangles(facelist);
+				for (auto const & point : points)
+				{
+					Merge(leaf.local_cuboid, local_valid, point);
+					Point const model_point = matrix.Transform(point);
+					Merge(model_cuboid, model_valid, model_point);
+					Merge(io_model_cuboid, io_model_cuboid_valid, model_point);
+				}
+			}
+			it.Next();
+		}
+
+		io_triangle_count += leaf.triangle_count;
+		if (is_leaf && local_valid && leaf.triangle_count > 0)
+		{
+			leaf.model_diagonal = Diagonal(model_cuboid);
+			io_leaves.push_back(leaf);
+		}
+	}
+
+	void InsertBox(SegmentKey & in_proxy, SimpleCuboid const & in_cuboid)
+	{
+		PointArray points(8);
+		for (int i = 0; i < 8; ++i)
+		{
+			points[i] = Point((i & 1) ? in_cuboid.max.x : in_cuboid.min.x,
+							  (i & 2) ? in_cuboid.max.y : in_cuboid.min.y,
+							  (i & 4) ? in_cuboid.max.z : in_cuboid.min.z);
+		}
+		int const faces[] = {
+			4, 0, 2, 3, 1,
+			4, 4, 5, 7, 6,
+			4, 0, 1, 5, 4,
+			4, 2, 6, 7, 3,
+			4, 0, 4, 6, 2,
+			4, 1, 3, 7, 5,
+		};
+		in_proxy.InsertShell(points, IntArray(faces, faces + sizeof(faces) / sizeof(faces[0])));
+	}
+
+	void MergeShells(SegmentKey const & in_segment, PointArray & out_points, IntArray & out_facelist)
+	{
+		SearchResults results;
+		in_segment.Find(Search::Type::Shell, Search::Space::SegmentOnly, results);
+		auto it = results.GetIterator();
+		while (it.IsValid())
+		{
+			ShellKey shell(it.GetItem());
+			PointArray points;
+			IntArray facelist;
+			if (shell.ShowPoints(points) && shell.ShowFacelist(facelist))
+			{
+				int const offset = static_cast<int>(out_points.size());
+				out_points.insert(out_points.end(), points.begin(), points.end());
+				size_t i = 0;
+				while (i < facelist.size())
+				{
+					int const count = facelist[i++];
+					out_facelist.push_back(count);
+					size_t const end = i + static_cast<size_t>(count < 0 ? -count : count);
+					for (; i < end; ++i)
+						out_facelist.push_back(facelist[i] + offset);
+				}
+			}
+			it.Next();
+		}
+	}
+
+	//reads the model and decimates its segments, without editing the database
+	bool ComputeProxies(SegmentKey const & in_model_segment, size_t in_minimum_triangle_count, std::atomic<bool> const & in_cancel, ProxyBuild & out_build)
+	{
+		std::vector<Leaf> leaves;
+		std::unordered_set<Key, KeyHasher> visited;
+		size_t triangle_count = 0;
+		SimpleCuboid model_cuboid;
+		bool model_cuboid_valid = false;
+		CollectLeaves(in_model_segment, MatrixKit::GetDefault(), visited, leaves, triangle_count, model_cuboid, model_cuboid_valid);
+		if (in_cancel || triangle_count < in_minimum_triangle_count || !model_cuboid_valid)
+			return false;
+
+		float const tiny_diagonal = Diagonal(model_cuboid) * tiny_segment_ratio;
+		size_t untouched_triangles = triangle_count;
+		for (auto const & leaf : leaves)
+		{
+			bool const tiny = leaf.model_diagonal < tiny_diagonal && leaf.triangle_count > box_triangles;
+			if (!tiny && leaf.triangle_count < minimum_segment_triangles)
+				continue;
+
+			LeafProxy proxy;
+			proxy.segment = leaf.segment;
+			proxy.box = tiny;
+			proxy.cuboid = leaf.local_cuboid;
+			out_build.leaves.push_back(proxy);
+			untouched_triangles -= leaf.triangle_count;
+		}
+		if (out_build.leaves.empty())
+			return false;
+
+		FloatArray const ratios(level_ratios, level_ratios + level_count);
+		size_t const job_count = out_build.leaves.size();
+		size_t const worker_count = (std::min)((std::max)(static_cast<size_t>(std::thread::hardware_concurrency()), static_cast<size_t>(1)), job_count);
+		std::atomic<size_t> next_job(0);
+		std::atomic<bool> failed(false);
+		auto worker = [&]()
+		{
+			try
+			{
+				for (size_t job = next_job++; job < job_count && !in_cancel; job = next_job++)
+				{
+					LeafProxy & proxy = out_build.leaves[job];
+					if (proxy.box)
+						continue;
+					PointArray points;
+					IntArray facelist;
+					MergeShells(proxy.segment, points, facelist);
+					if (!MeshDecimator::Decimate(points, facelist, ratios, proxy.levels, &in_cancel))
+						proxy.box = true;
+				}
+			}
+			catch (HPS::InvalidObjectException const &)
+			{
+				//the model was deleted while it was being decimated
+				failed = true;
+			}
+		};
+
+		std::vector<std::thread> workers;
+		for (size_t i = 1; i < worker_count; ++i)
+			workers.emplace_back(worker);
+		worker();
+		for (auto & one_worker : workers)
+			one_worker.join();
+		if (in_cancel || failed)
+			return false;
+
+		for (size_t level = 0; level < level_count; ++level)
+		{
+			out_build.level_triangles[level] = untouched_triangles;
+			for (auto const & proxy : out_build.leaves)
+				out_build.level_triangles[level] += proxy.box ? box_triangles : proxy.levels[level].facelist.size() / 4;
+		}
+		return true;
+	}
+
+	void DeleteProxies(ModelProxies & in_proxies, Model const & in_model)
+	{
+		for (auto & style : in_proxies.detail_styles)
+		{
+			if (style.Type() != HPS::Type::None)
+				style.Delete();
+		}
+		for (auto & proxy : in_proxies.proxies)
+		{
+			if (proxy.Type() != HPS::Type::None)
+				proxy.Delete();
+		}
+		if (in_proxies.style_sources.Type() != HPS::Type::None)
+			in_proxies.style_sources.Delete();
+
+		if (in_model.Type() != HPS::Type::None)
+		{
+			Model model = in_model;
+			model.GetPortfolioKey().UndefineNamedStyle(detail_hidden_style).UndefineNamedStyle(proxy_hidden_style).UndefineNamedStyle(proxy_shown_style);
+			model.GetSegmentKey().GetPerformanceControl().UnsetStaticConditions();
+		}
+	}
+
+	//inserts the proxies in the model and sets up the styles which switch to them
+	ModelProxies ApplyProxies(Model const & in_model, ProxyBuild const & in_build, size_t in_minimum_triangle_count, size_t in_triangle_budget)
+	{
+		Model model = in_model;
+		ModelProxies proxies;
+		proxies.model = in_model;
+		proxies.level = level_count - 1;
+		proxies.minimum_triangle_count = in_minimum_triangle_count;
+		for (size_t level = 0; level < level_count; ++level)
+		{
+			if (in_build.level_triangles[level] <= in_triangle_budget)
+			{
+				proxies.level = level;
+				break;
+			}
+		}
+
+		proxies.style_sources = Database::CreateRootSegment();
+		SegmentKey detail_hidden = proxies.style_sources.Subsegment(detail_hidden_style);
+		detail_hidden.GetVisibilityControl().SetFaces(false).SetEdges(false);
+		SegmentKey proxy_hidden = proxies.style_sources.Subsegment(proxy_hidden_style);
+		proxy_hidden.GetVisibilityControl().SetEverything(false);
+		SegmentKey proxy_shown = proxies.style_sources.Subsegment(proxy_shown_style);
+		proxy_shown.GetVisibilityControl().SetFaces(true);
+
+		PortfolioKey portfolio = model.GetPortfolioKey();
+		portfolio.DefineNamedStyle(detail_hidden_style, detail_hidden);
+		portfolio.DefineNamedStyle(proxy_hidden_style, proxy_hidden);
+		portfolio.DefineNamedStyle(proxy_shown_style, proxy_shown);
+
+		ConditionalExpression const interacting(interaction_condition);
+		for (auto const & leaf : in_build.leaves)
+		{
+			SegmentKey segment = leaf.segment;
+			SegmentKey proxy = segment.Subsegment(proxy_segment_name);
+			proxy.GetBoundingControl().SetExclusion(true);
+			proxy.GetSelectabilityControl().SetEverything(Selectability::Value::Off);
+			proxy.GetStyleControl().PushNamed(proxy_hidden_style, !interacting);
+
+			if (leaf.box)
+			{
+				InsertBox(proxy, leaf.cuboid);
+				proxy.GetStyleControl().PushNamed(proxy_shown_style, interacting);
+			}
+			else
+			{
+				//the levels stay hidden by the visibility of the original segment unless their condition is set
+				for (size_t level = 0; level < level_count; ++level)
+				{
+					SegmentKey level_segment = proxy.Subsegment(level_segment_names[level]);
+					level_segment.InsertShell(leaf.levels[level].points, leaf.levels[level].facelist);
+					level_segment.GetStyleControl().PushNamed(proxy_shown_style, ConditionalExpression(level_conditions[level]));
+				}
+			}
+
+			proxies.detail_styles.push_back(segment.GetStyleControl().PushNamed(detail_hidden_style, interacting));
+			proxies.proxies.push_back(proxy);
+		}
+
+		//keep the conditions in the static tree, so that switching to the proxies does not regenerate it
+		model.GetSegmentKey().GetPerformanceControl().SetStaticConditions(Performance::StaticConditions::Independent);
+		return proxies;
+	}
+
+	void StopBuilding(LODState & in_state, Key const & in_model_segment, std::thread & out_builder)
+	{
+		if (in_state.cancel && (in_model_segment.Type() == HPS::Type::None || in_state.building == in_model_segment))
+		{
+			*in_state.cancel = true;
+			out_builder = std::move(in_state.builder);
+			in_state.building = Key();
+		}
+	}
+
+	void UnsetConditions(SegmentKey & in_view_segment, Interaction const & in_interaction)
+	{
+		in_view_segment.GetConditionControl().UnsetCondition(interaction_condition).UnsetCondition(level_conditions[in_interaction.level]);
+	}
+}
+
+bool HPS::InteractionLOD::Generate(HPS::Model const & in_model, size_t in_minimum_triangle_count)
+{
+	Remove(in_model);
+	if (in_model.Type() == HPS::Type::None)
+		return false;
+
+	std::atomic<bool> cancel(false);
+	ProxyBuild build;
+	if (!ComputeProxies(in_model.GetSegmentKey(), in_minimum_triangle_count, cancel, build))
+		return false;
+
+	ModelProxies proxies = ApplyProxies(in_model, build, in_minimum_triangle_count, GetTriangleBudget());
+	LODState & state = GetLODState();
+	std::lock_guard<std::mutex> lock(state.mutex);
+	state.models[in_model.GetSegmentKey()] = proxies;
+	return true;
+}
+
+void HPS::InteractionLOD::GenerateAsync(HPS::Model const & in_model, size_t in_minimum_triangle_count)
+{
+	Remove(in_model);
+	if (in_model.Type() == HPS::Type::None)
+		return;
+
+	Model model = in_model;
+	SegmentKey model_segment = model.GetSegmentKey();
+	std::shared_ptr<std::atomic<bool>> cancel = std::make_shared<std::atomic<bool>>(false);
+
+	LODState & state = GetLODState();
+	std::thread previous_builder;
+	{
+		std::lock_guard<std::mutex> lock(state.mutex);
+		if (state.cancel)
+			*state.cancel = true;
+		previous_builder = std::move(state.builder);
+
+		state.building = model_segment;
+		state.building_model.model = model;
+		state.building_model.minimum_triangle_count = in_minimum_triangle_count;
+		state.cancel = cancel;
+		state.builder = std::thread([model, model_segment, in_minimum_triangle_count, cancel]()
+		{
+			try
+			{
+				ProxyBuild build;
+				if (!ComputeProxies(model_segment, in_minimum_triangle_count, *cancel, build))
+					return;
+
+				ModelProxies proxies = ApplyProxies(model, build, in_minimum_triangle_count, GetTriangleBudget());
+				{
+					LODState & state = GetLODState();
+					std::lock_guard<std::mutex> lock(state.mutex);
+					if (!*cancel)
+					{
+						state.models[model_segment] = proxies;
+						return;
+					}
+				}
+				//cancelled while the proxies were being inserted
+				DeleteProxies(proxies, model);
+			}
+			catch (HPS::InvalidObjectException const &)
+			{
+				//the model was deleted while its proxies were being built
+			}
+		});
+	}
+
+	if (previous_builder.joinable())
+		previous_builder.join();
+}
+
+void HPS::InteractionLOD::Remove(HPS::Model const & in_model)
+{
+	if (in_model.Type() == HPS::Type::None)
+		return;
+
+	SegmentKey model_segment = in_model.GetSegmentKey();
+	LODState & state = GetLODState();
+	std::thread builder;
+	{
+		std::lock_guard<std::mutex> lock(state.mutex);
+		StopBuilding(state, model_segment, builder);
+		state.stale.erase(model_segment);
+	}
+	if (builder.joinable())
+		builder.join();
+
+	ModelProxies proxies;
+	{
+		std::lock_guard<std::mutex> lock(state.mutex);
+		auto it = state.models.find(model_segment);
+		if (it == state.models.end())
+			return;
+		proxies = it->second;
+		state.models.erase(it);
+	}
+	DeleteProxies(proxies, in_model);
+}
+
+void HPS::InteractionLOD::Shutdown()
+{
+	LODState & state = GetLODState();
+	std::thread builder;
+	{
+		std::lock_guard<std::mutex> lock(state.mutex);
+		StopBuilding(state, Key(), builder);
+		state.models.clear();
+		state.interactions.clear();
+		state.stale.clear();
+	}
+	if (builder.joinable())
+		builder.join();
+}
+
+size_t HPS::InteractionLOD::ReleaseAll()
+{
+	LODState & state = GetLODState();
+	std::thread builder;
+	std::vector<ModelProxies> removed;
+	{
+		std::lock_guard<std::mutex> lock(state.mutex);
+		if (state.building.Type() != HPS::Type::None)
+			state.stale[state.building] = state.building_model;
+		StopBuilding(state, Key(), builder);
+		for (auto & model : state.models)
+		{
+			StaleModel stale;
+			stale.model = model.second.model;
+			stale.minimum_triangle_count = model.second.minimum_triangle_count;
+			state.stale[model.first] = stale;
+			removed.push_back(model.second);
+		}
+		state.models.clear();
+	}
+	if (builder.joinable())
+		builder.join();
+
+	size_t count = 0;
+	for (auto & proxies : removed)
+	{
+		count += proxies.proxies.size();
+		DeleteProxies(proxies, proxies.model);
+	}
+	return count;
+}
+
+bool HPS::InteractionLOD::IsAvailable(HPS::Model const & in_model)
+{
+	if (in_model.Type() == HPS::Type::None)
+		return false;
+
+	LODState & state = GetLODState();
+	std::lock_guard<std::mutex> lock(state.mutex);
+	return state.models.find(in_model.GetSegmentKey()) != state.models.end();
+}
+
+bool HPS::InteractionLOD::IsProxySegment(HPS::SegmentKey const & in_segment)
+{
+	return in_segment.Name() == proxy_segment_name;
+}
+
+void HPS::InteractionLOD::BeginInteraction(HPS::View const & in_view)
+{
+	if (in_view.Type() == HPS::Type::None)
+		return;
+	Model model = in_view.GetAttachedModel();
+	if (model.Type() == HPS::Type::None)
+		return;
+
+	LODState & state = GetLODState();
+	std::unique_lock<std::mutex> lock(state.mutex);
+	auto proxies = state.models.find(model.GetSegmentKey());
+	if (proxies == state.models.end())
+	{
+		//released proxies are generated again in the background, this interaction is drawn at full detail
+		auto stale = state.stale.find(model.GetSegmentKey());
+		if (stale == state.stale.end())
+			return;
+		size_t const minimum_triangle_count = stale->second.minimum_triangle_count;
+		state.stale.erase(stale);
+		lock.unlock();
+		GenerateAsync(model, minimum_triangle_count);
+		return;
+	}
+
+	SegmentKey view_segment = in_view.GetSegmentKey();
+	auto it = state.interactions.find(view_segment);
+	if (it == state.interactions.end())
+	{
+		Interaction interaction;
+		interaction.level = proxies->second.level;
+		it = state.interactions.insert(std::make_pair(Key(view_segment), interaction)).first;
+		view_segment.GetConditionControl().AddCondition(interaction_condition).AddCondition(level_conditions[interaction.level]);
+	}
+	it->second.last_move = Clock::now();
+}
+
+void HPS::InteractionLOD::EndInteraction(HPS::View const & in_view)
+{
+	if (in_view.Type() == HPS::Type::None)
+		return;
+
+	LODState & state = GetLODState();
+	std::lock_guard<std::mutex> lock(state.mutex);
+	SegmentKey view_segment = in_view.GetSegmentKey();
+	auto it = state.interactions.find(view_segment);
+	if (it == state.interactions.end())
+		return;
+	UnsetConditions(view_segment, it->second);
+	state.interactions.erase(it);
+}
+
+bool HPS::InteractionLOD::Tick(HPS::View const & in_view)
+{
+	if (in_view.Type() == HPS::Type::None)
+		return false;
+
+	LODState & state = GetLODState();
+	std::lock_guard<std::mutex> lock(state.mutex);
+	SegmentKey view_segment = in_view.GetSegmentKey();
+	auto it = state.interactions.find(view_segment);
+	if (it == state.interactions.end())
+		return false;
+
+	std::chrono::duration<float> const idle_time = Clock::now() - it->second.last_move;
+	if (idle_time.count() < state.idle_delay)
+		return false;
+
+	UnsetConditions(view_segment, it->second);
+	state.interactions.erase(it);
+	return true;
+}
+
+void HPS::InteractionLOD::SetIdleDelay(float in_seconds)
+{
+	LODState & state = GetLODState();
+	std::lock_guard<std::mutex> lock(state.mutex);
+	state.idle_delay = (std::max)(in_seconds, 0.0f);
+}
+
+float HPS::InteractionLOD::GetIdleDelay()
+{
+	LODState & state = GetLODState();
+	std::lock_guard<std::mutex> lock(state.mutex);
+	return state.idle_delay;
+}
+
+void HPS::InteractionLOD::SetTriangleBudget(size_t in_triangle_count)
+{
+	LODState & state = GetLODState();
+	std::lock_guard<std::mutex> lock(state.mutex);
+	state.triangle_budget = in_triangle_count;
+}
+
+size_t HPS::InteractionLOD::GetTriangleBudget()
+{
+	LODState & state = GetLODState();
+	std::lock_guard<std::mutex> lock(state.mutex);
+	return state.triangle_budget;
+}
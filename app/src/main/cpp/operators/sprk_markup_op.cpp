@@ -24,6 +24,9 @@ HPS::MarkupOperator::MarkupOperator(MouseButtons in_mouse_trigger, ModifierKeys
 	, markup_type(MarkupOperator::MarkupType::Freehand)
 	, start_new_line(false)
 	, current_line_size(0)
+	, freehand_tolerance(2.0f)
+	, freehand_last_pending(false)
+	, freehand_tail_dropped(false)
 	, start_new_note(true)
     , keyboard_active(false)
 	, current_text_row(0)
@@ -128,12 +131,14 @@ bool HPS::MarkupOperator::OnMouseDown(MouseState const & in_state)
 		event_path.ConvertCoordinate(HPS::Coordinate::Space::Window, in_state.GetLocation(), HPS::Coordinate::Space::World, world_point);
 
 		start_point = world_point;
+		event_path.ConvertCoordinate(HPS::Coordinate::Space::Window, in_state.GetLocation(), HPS::Coordinate::Space::Pixel, start_pixel_point);
 		start_new_line = true;
 
 		operator_active = true;
 
 		current_line = HPS::LineKey();
 		current_line_size = 0;
+		StartFreehand();
 		current_rectangle = HPS::LineKey();
 		current_circle = HPS::CircleKey();
 		current_circle_line = HPS::LineKey();
@@ -161,6 +166,9 @@ bool HPS::MarkupOperator::OnMouseUp(MouseState const & in_state)
 	{
 		if (operator_active)
 		{
+			if (markup_type == MarkupType::Freehand && CommitFreehand(true))
+				last_attached_view.Update();
+
 			if (markup_type == MarkupType::Circle && !current_circle_line.Empty())
 			{
 				MarkupInsertedEvent event(current_circle_line, last_attached_view); 
@@ -195,7 +203,14 @@ bool HPS::MarkupOperator::OnMouseMove(HPS::MouseState const & in_state)
 		event_path.ConvertCoordinate(HPS::Coordinate::Space::Window, in_state.GetLocation(), HPS::Coordinate::Space::World, world_point);
 
 		if (markup_type == MarkupType::Freehand)
-			DrawFreehand(world_point);
+		{
+			//freehand points are added to the line in chunks, see OnTimerTick
+			HPS::Point pixel_point;
+			event_path.ConvertCoordinate(HPS::Coordinate::Space::Window, in_state.GetLocation(), HPS::Coordinate::Space::Pixel, pixel_point);
+			if (DrawFreehand(world_point, pixel_point))
+				last_attached_view.Update();
+			return true;
+		}
 		else if (markup_type == MarkupType::Circle)
 			DrawCircle(world_point);
 		else if (markup_type == MarkupType::Rectangle)
@@ -268,9 +283,12 @@ bool HPS::MarkupOperator::OnTouchDown(const HPS::TouchState &in_state)
         }
 
         start_point = world_point;
+        event_path = markup_segment + in_state.GetEventPath();
+        event_path.ConvertCoordinate(HPS::Coordinate::Space::Window, touches[0].Location, HPS::Coordinate::Space::Pixel, start_pixel_point);
         start_new_line = true;
         operator_active = true;
         tracked_touch_id = touches[0].ID;
+        StartFreehand();
     }
 
     return false;
@@ -314,7 +332,14 @@ bool HPS::MarkupOperator::OnTouchMove(const HPS::TouchState &in_state)
         event_path.ConvertCoordinate(HPS::Coordinate::Space::Window, touches[0].Location, HPS::Coordinate::Space::World, world_point);
 
         if (markup_type == MarkupType::Freehand)
-            DrawFreehand(world_point);
+        {
+            //freehand points are added to the line in chunks, see OnTimerTick
+            HPS::Point pixel_point;
+            event_path.ConvertCoordinate(HPS::Coordinate::Space::Window, touches[0].Location, HPS::Coordinate::Space::Pixel, pixel_point);
+            if (DrawFreehand(world_point, pixel_point))
+                last_attached_view.Update();
+            return true;
+        }
         else if (markup_type == MarkupType::Circle)
             DrawCircle(world_point);
         else if (markup_type == MarkupType::Rectangle)
@@ -341,6 +366,9 @@ bool HPS::MarkupOperator::OnTouchUp(const HPS::TouchState &in_state)
 
 	if (operator_active)
 	{
+		if (markup_type == MarkupType::Freehand && CommitFreehand(true))
+			last_attached_view.Update();
+
 		if (markup_type == MarkupType::Circle && !current_circle_line.Empty())
 		{
 			MarkupInsertedEvent event(current_circle_line, last_attached_view);
@@ -377,7 +405,10 @@ bool HPS::MarkupOperator::OnKeyDown(KeyboardState const & in_state)
 				EndTextNote();
 			}
 			else if(markup_type == MarkupType::Freehand)
+			{
 				current_line.Delete();
+				StartFreehand();
+			}
 			else if(markup_type == MarkupType::Circle)
 				current_circle_line.Delete();
 			else if(markup_type == MarkupType::Rectangle)
@@ -514,24 +545,114 @@ bool HPS::MarkupOperator::OnTextInput(const HPS::UTF8 & in_text)
     return false;
 }
 
-void HPS::MarkupOperator::DrawFreehand(Point const & location)
+void HPS::MarkupOperator::StartFreehand()
 {
+	freehand_points.clear();
+	freehand_skipped.clear();
+	freehand_anchor = start_pixel_point;
+	freehand_last = start_pixel_point;
+	freehand_last_pending = false;
+	freehand_tail_dropped = false;
+}
+
+bool HPS::MarkupOperator::DrawFreehand(Point const & location, Point const & pixel_location)
+{
+	if (!start_new_line && current_line.Empty())
+	{
+		//current_line got deleted someone, probably by the user. Restart the line from this point
+		start_new_line = true;
+		current_line_size = 0;
+		start_point = location;
+		start_pixel_point = pixel_location;
+		StartFreehand();
+		return false;
+	}
+
+	freehand_tail = location;
+	freehand_tail_dropped = true;
+
+	//radial distance: drop samples too close to the last point kept
+	if (Vector(pixel_location - freehand_last).Length() <= freehand_tolerance)
+		return false;
+	freehand_tail_dropped = false;
+
+	//if the last point kept and everything dropped before it are within tolerance of the segment from the anchor to this sample,
+	//this sample replaces the last point kept
+	bool replace_last = false;
+	if (freehand_last_pending && freehand_tolerance > 0 && freehand_skipped.size() < 64)
+	{
+		Vector const segment(pixel_location - freehand_anchor);
+		double const segment_length = segment.Length();
+		auto distance_to_segment = [&](Point const & point)
+		{
+			Vector const offset(point - freehand_anchor);
+			if (segment_length == 0)
+				return offset.Length();
+			double const parameter = HPS::Clamp(offset.Dot(segment) / (segment_length * segment_length), 0.0, 1.0);
+			return Vector(offset - segment * static_cast<float>(parameter)).Length();
+		};
+
+		replace_last = distance_to_segment(freehand_last) <= freehand_tolerance;
+		for (size_t i = 0; replace_last && i < freehand_skipped.size(); ++i)
+			replace_last = distance_to_segment(freehand_skipped[i]) <= freehand_tolerance;
+	}
+
+	if (replace_last)
+	{
+		freehand_skipped.push_back(freehand_last);
+		freehand_points.back() = location;
+	}
+	else
+	{
+		freehand_skipped.clear();
+		freehand_anchor = freehand_last;
+		freehand_points.push_back(location);
+		freehand_last_pending = true;
+	}
+	freehand_last = pixel_location;
+
+	//do not let the buffer grow if timer ticks are late
+	if (freehand_points.size() >= 256)
+		return CommitFreehand(false);
+	return false;
+}
+
+bool HPS::MarkupOperator::CommitFreehand(bool end_of_stroke)
+{
+	if (end_of_stroke && freehand_tail_dropped)
+	{
+		freehand_points.push_back(freehand_tail);
+		freehand_tail_dropped = false;
+	}
+
+	if (freehand_points.empty())
+		return false;
+
 	if (start_new_line)
 	{
 		LookupSegment();
-		current_line = current_segment.InsertLine(start_point, location);
+		freehand_points.insert(freehand_points.begin(), start_point);
+		current_line = current_segment.InsertLine(freehand_points);
 		start_new_line = false;
-		start_point = location;
-		current_line_size = 2;
+		current_line_size = freehand_points.size();
 	}
 	else if (!current_line.Empty())
-		current_line = current_line.EditPointsByInsertion(current_line_size++, 1, &location);
-	else
 	{
-		//current_line got deleted someone, probably by the user. Reset the line
-		start_new_line = true;
-		current_line_size = 0;
+		current_line = current_line.EditPointsByInsertion(current_line_size, freehand_points.size(), freehand_points.data());
+		current_line_size += freehand_points.size();
 	}
+
+	//points already in the database are not replaced anymore
+	freehand_points.clear();
+	freehand_last_pending = false;
+	return true;
+}
+
+bool HPS::MarkupOperator::OnTimerTick(HPS::TimerTickEvent const &)
+{
+	if (operator_active && markup_type == MarkupType::Freehand && CommitFreehand(false))
+		last_attached_view.Update();
+	return false;
 }
 
 void HPS::MarkupOperator::DrawCircle(Point const & location)
@@ -0,0 +1,892 @@
+// Copyright (c) Tech Soft 3D, Inc.
+//
+// The information contained herein is confidential and proprietary to Tech Soft 3D, Inc.,
+// and considered a trade secret as defined under civil and criminal statutes.
+// Tech Soft 3D, Inc. shall pursue its civil and criminal remedies in the event of
+// unauthorized use or misappropriation of its trade secrets.  Use of this information
+// by anyone other than authorized employees of Tech Soft 3D, Inc. is granted only under
+// a written non-disclosure agreement, expressly prescribing the scope and manner of such use.
+
+#include "sprk_ops.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+
+using namespace HPS;
+
+namespace
+{
+	char const * const budget_proxy_name = "hps_budget_proxy";
+
+	//estimated bytes of a vertex (position and normal) and of a triangle (three 32-bit indices) once uploaded
+	const size_t vertex_bytes = 24;
+	const size_t triangle_bytes = 12;
+	//after going over budget, segments are unloaded until this fraction of the budget is used, and loaded back only up to it
+	const float low_water_ratio = 0.9f;
+	//how long the camera must stay still before the budget is applied
+	const float settle_delay = 0.5f;
+	//segments loaded back on each settled camera, reading files is slow enough to be noticed
+	const size_t max_loads_per_apply = 8;
+
+	typedef std::chrono::steady_clock Clock;
+
+	struct TrackedSegment
+	{
+		SegmentKey			segment;
+		SimpleCuboid		cuboid;			//in model space, over all the instances of the segment
+		size_t				bytes;
+		Clock::time_point	last_visible;
+		float				coverage;		//fraction of the view the segment covered at the last check, zero outside of the frustum
+		bool				unloaded;
+		bool				busy;			//an unload or a load of the segment is in flight
+		std::string			spill_file;
+		SegmentKey			proxy;
+	};
+
+	//an unload or a load of a segment, planned under the lock and carried out without it
+	struct SpillJob
+	{
+		Key					model;
+		size_t				index;			//of the segment in the tracked model
+		SegmentKey			segment;
+		size_t				bytes;
+		bool				load;
+		std::string			spill_file;
+		SegmentKey			proxy;
+		bool				succeeded;
+	};
+
+	struct TrackedModel
+	{
+		View								view;
+		Model								model;
+		std::vector<TrackedSegment>			segments;
+		size_t								resident_bytes;
+		CameraKit							camera;
+		Clock::time_point					camera_change;
+		bool								settled;
+		bool								held;			//kept loaded by LoadAll until Resume
+	};
+
+	class BudgetEventHandler : public EventHandler
+	{
+	public:
+		BudgetEventHandler()
+			: EventHandler()
+		{ }
+
+		virtual ~BudgetEventHandler()
+		{ Shutdown(); }
+
+		virtual HandleResult Handle(Event const * in_event);
+	};
+
+	struct BudgetState
+	{
+		BudgetState() : budget(256 * 1024 * 1024), spill_serial(0), applying(0) {}
+
+		std::mutex											mutex;
+		std::unordered_map<Key, TrackedModel, KeyHasher>	models;
+		size_t												budget;
+		std::string											spill_directory;
+		size_t												spill_serial;
+		std::unique_ptr<BudgetEventHandler>					handler;
+		std::thread											worker;			//reads and writes the spill files, the last one started
+		size_t												applying;		//workers started and not yet done
+		std::vector<View>									pending_updates;	//views changed by the worker, updated on the next tick
+	};
+
+	BudgetState & GetBudgetState()
+	{
+		static BudgetState budget_state;
+		return budget_state;
+	}
+
+	void Merge(SimpleCuboid & io_cuboid, bool & io_valid, Point const & in_point)
+	{
+		if (!io_valid)
+		{
+			io_cuboid = SimpleCuboid(in_point, in_point);
+			io_valid = true;
+			return;
+		}
+		io_cuboid.min.x = (std::min)(io_cuboid.min.x, in_point.x);
+		io_cuboid.min.y = (std::min)(io_cuboid.min.y, in_point.y);
+		io_cuboid.min.z = (std::min)(io_cuboid.min.z, in_point.z);
+		io_cuboid.max.x = (std::max)(io_cuboid.max.x, in_point.x);
+		io_cuboid.max.y = (std::max)(io_cuboid.max.y, in_point.y);
+		io_cuboid.max.z = (std::max)(io_cuboid.max.z, in_point.z);
+	}
+
+	void Collect(SegmentKey const & in_segment, MatrixKit const & in_parent_matrix, std::unordered_map<Key, size_t, KeyHasher> & io_indices, std::vector<TrackedSegment> & io_segments)
+	{
+		if (InteractionLOD::IsProxySegment(in_segment) || MemoryBudget::IsProxySegment(in_segment))
+			return;
+
+		MatrixKit matrix = in_parent_matrix;
+		MatrixKit local_matrix;
+		if (in_segment.ShowModellingMatrix(local_matrix))
+			matrix = local_matrix.Multiply(in_parent_matrix);
+
+		auto index = io_indices.find(in_segment);
+		bool const first_visit = index == io_indices.end();
+		if (first_visit)
+		{
+			SearchResults results;
+			if (in_segment.Find(Search::Type::Shell, Search::Space::SegmentOnly, results) > 0)
+			{
+				TrackedSegment tracked;
+				tracked.segment = in_segment;
+				tracked.bytes = 0;
+				tracked.coverage = 0;
+				tracked.unloaded = false;
+				tracked.busy = false;
+				auto it = results.GetIterator();
+				while (it.IsValid())
+				{
+					//faces are counted as triangles, which is what tessellated models are made of
+					ShellKey shell(it.GetItem());
+					tracked.bytes += shell.GetPointCount() * vertex_bytes + shell.GetFaceCount() * triangle_bytes;
+					it.Next();
+				}
+
+				BoundingKit bounding;
+				SimpleSphere sphere;
+				SimpleCuboid cuboid;
+				if (in_segment.ShowBounding(bounding) && bounding.ShowVolume(sphere, cuboid))
+				{
+					//the cuboid is empty until the first instance is merged in below
+					tracked.cuboid = SimpleCuboid(Point::Zero(), Point::Zero());
+					index = io_indices.insert(std::make_pair(Key(in_segment), io_segments.size())).first;
+					io_segments.push_back(tracked);
+				}
+			}
+		}
+
+		if (index != io_indices.end())
+		{
+			//each instance of a segment extends the region in which it can be seen
+			BoundingKit bounding;
+			SimpleSphere sphere;
+			SimpleCuboid cuboid;
+			if (in_segment.ShowBounding(bounding) && bounding.ShowVolume(sphere, cuboid))
+			{
+				TrackedSegment & tracked = io_segments[index->second];
+				bool valid = !first_visit;
+				for (int i = 0; i < 8; ++i)
+				{
+					Point const corner((i & 1) ? cuboid.max.x : cuboid.min.x, (i & 2) ? cuboid.max.y : cuboid.min.y, (i & 4) ? cuboid.max.z : cuboid.min.z);
+					Merge(tracked.cuboid, valid, matrix.Transform(corner));
+				}
+			}
+		}
+
+		SegmentKeyArray children;
+		in_segment.ShowSubsegments(children);
+		for (auto const & child : children)
+			Collect(child, matrix, io_indices, io_segments);
+
+		SearchResults results;
+		if (in_segment.Find(Search::Type::Include, Search::Space::SegmentOnly, results) > 0)
+		{
+			auto it = results.GetIterator();
+			while (it.IsValid())
+			{
+				Collect(IncludeKey(it.GetItem()).GetTarget(), matrix, io_indices, io_segments);
+				it.Next();
+			}
+		}
+	}
+
+	//conservative test of a cuboid against the view frustum, the field is widened to its larger side since the window aspect is not known here
+	float Coverage(CameraKit const & in_camera, SimpleCuboid const & in_cuboid)
+	{
+		Point position, target;
+		Vector up;
+		float width, height;
+		Camera::Projection projection;
+		if (!in_camera.ShowPosition(position) || !in_camera.ShowTarget(target) || !in_camera.ShowUpVector(up) ||
+			!in_camera.ShowField(width, height) || !in_camera.ShowProjection(projection))
+			return 1;
+
+		Vector view_direction = target - position;
+		float const target_distance = static_cast<float>(view_direction.Length());
+		if (target_distance <= 0)
+			return 1;
+		view_direction.Normalize();
+		Vector right = view_direction.Cross(up);
+		right.Normalize();
+		Vector const true_up = right.Cross(view_direction);
+
+		float const half_field = 0.5f * (std::max)(width, height);
+		float const radius = 0.5f * static_cast<float>(Vector(in_cuboid.max - in_cuboid.min).Length());
+		Vector const offset = Midpoint(in_cuboid.min, in_cuboid.max) - position;
+		float const depth = static_cast<float>(offset.Dot(view_direction));
+		float const x = std::fabs(static_cast<float>(offset.Dot(right)));
+		float const y = std::fabs(static_cast<float>(offset.Dot(true_up)));
+
+		if (projection == Camera::Projection::Orthographic || projection == Camera::Projection::Stretched)
+		{
+			if (x > half_field + radius || y > half_field + radius)
+				return 0;
+			return (std::min)(radius / half_field, 1.0f);
+		}
+
+		if (depth + radius <= 0)
+			return 0;
+		float const tangent = half_field / target_distance;
+		float const slack = radius * std::sqrt(1 + tangent * tangent);
+		float const half_extent = (std::max)(depth, 0.0f) * tangent;
+		if (x > half_extent + slack || y > half_extent + slack)
+			return 0;
+		if (depth <= radius)
+			return 1;
+		return (std::min)(radius / half_extent, 1.0f);
+	}
+
+	void InsertBox(SegmentKey & in_proxy, SimpleCuboid const & in_cuboid)
+	{
+		PointArray points(8);
+		for (int i = 0; i < 8; ++i)
+		{
+			points[i] = Point((i & 1) ? in_cuboid.max.x : in_cuboid.min.x,
+							  (i & 2) ? in_cuboid.max.y : in_cuboid.min.y,
+							  (i & 4) ? in_cuboid.max.z : in_cuboid.min.z);
+		}
+		int const faces[] = {
+			4, 0, 2, 3, 1,
+			4, 4, 5, 7, 6,
+			4, 0, 1, 5, 4,
+			4, 2, 6, 7, 3,
+			4, 0, 4, 6, 2,
+			4, 1, 3, 7, 5,
+		};
+		in_proxy.InsertShell(points, IntArray(faces, faces + sizeof(faces) / sizeof(faces[0])));
+	}
+
+	void MoveShells(SegmentKey const & in_from, SegmentKey const & in_to)
+	{
+		SearchResults results;
+		if (in_from.Find(Search::Type::Shell, Search::Space::SegmentOnly, results) == 0)
+			return;
+		auto it = results.GetIterator();
+		while (it.IsValid())
+		{
+			Key shell = it.GetItem();
+			shell.MoveTo(in_to);
+			it.Next();
+		}
+	}
+
+	bool Unload(SpillJob & io_job)
+	{
+		//the shells are moved to their own root so that only they end up in the file
+		SegmentKey holder = Database::CreateRootSegment();
+		MoveShells(io_job.segment, holder);
+
+		SimpleCuboid local_cuboid;
+		bool local_valid = false;
+		SearchResults results;
+		holder.Find(Search::Type::Shell, Search::Space::SegmentOnly, results);
+		auto it = results.GetIterator();
+		while (it.IsValid())
+		{
+			PointArray points;
+			if (ShellKey(it.GetItem()).ShowPoints(points))
+			{
+				for (auto const & point : points)
+					Merge(local_cuboid, local_valid, point);
+			}
+			it.Next();
+		}
+
+		IOResult status = IOResult::Failure;
+		try
+		{
+			Stream::ExportNotifier notifier = Stream::File::Export(io_job.spill_file.c_str(), holder, Stream::ExportOptionsKit());
+			notifier.Wait();
+			status = notifier.Status();
+		}
+		catch (IOException const & ex)
+		{
+			status = ex.result;
+		}
+
+		if (status != IOResult::Success || !local_valid)
+		{
+			MoveShells(holder, io_job.segment);
+			holder.Delete();
+			std::remove(io_job.spill_file.c_str());
+			return false;
+		}
+		holder.Delete();
+
+		//the box only stands in for the unloaded shells on screen, like the proxies of InteractionLOD
+		io_job.proxy = io_job.segment.Subsegment(budget_proxy_name);
+		io_job.proxy.GetBoundingControl().SetExclusion(true);
+		io_job.proxy.GetSelectabilityControl().SetEverything(Selectability::Value::Off);
+		InsertBox(io_job.proxy, local_cuboid);
+		return true;
+	}
+
+	bool Load(SpillJob & io_job)
+	{
+		SegmentKey holder = Database::CreateRootSegment();
+		IOResult status = IOResult::Failure;
+		try
+		{
+			Stream::ImportOptionsKit options;
+			options.SetSegment(holder);
+			Stream::ImportNotifier notifier = Stream::File::Import(io_job.spill_file.c_str(), options);
+			notifier.Wait();
+			status = notifier.Status();
+		}
+		catch (IOException const & ex)
+		{
+			status = ex.result;
+		}
+
+		if (status != IOResult::Success)
+		{
+			holder.Delete();
+			return false;
+		}
+
+		MoveShells(holder, io_job.segment);
+		holder.Delete();
+		if (io_job.proxy.Type() != HPS::Type::None)
+			io_job.proxy.Delete();
+		std::remove(io_job.spill_file.c_str());
+		return true;
+	}
+
+	void UpdateVisibility(TrackedModel & io_tracked)
+	{
+		io_tracked.view.GetSegmentKey().ShowCamera(io_tracked.camera);
+		Clock::time_point const now = Clock::now();
+		for (auto & tracked : io_tracked.segments)
+		{
+			tracked.coverage = Coverage(io_tracked.camera, tracked.cuboid);
+			if (tracked.coverage > 0)
+				tracked.last_visible = now;
+		}
+		io_tracked.settled = true;
+	}
+
+	std::string NextSpillFile(BudgetState & io_state)
+	{
+		return io_state.spill_directory + "/hps_budget_" + std::to_string(io_state.spill_serial++) + ".hsf";
+	}
+
+	void InvalidateCaches(Model const & in_model)
+	{
+		//the shells were deleted or recreated, which the caches of the model do not know about
+		PickingIndex::Invalidate(in_model);
+		SelectionCache::Invalidate(in_model);
+		BoundingCache::Invalidate(in_model);
+		WalkOperator::InvalidateTerrain(in_model);
+	}
+
+	void AddJob(TrackedModel & io_tracked, size_t in_index, bool in_load, BudgetState & io_state, std::vector<SpillJob> & io_jobs)
+	{
+		TrackedSegment & tracked = io_tracked.segments[in_index];
+		tracked.busy = true;
+
+		SpillJob job;
+		job.model = io_tracked.model.GetSegmentKey();
+		job.index = in_index;
+		job.segment = tracked.segment;
+		job.bytes = tracked.bytes;
+		job.load = in_load;
+		job.spill_file = in_load ? tracked.spill_file : NextSpillFile(io_state);
+		job.proxy = tracked.proxy;
+		job.succeeded = false;
+		io_jobs.push_back(job);
+	}
+
+	//decides which segments to unload or load back, the files are only touched once the lock is released
+	void PlanBudget(TrackedModel & io_tracked, BudgetState & io_state, std::vector<SpillJob> & io_jobs)
+	{
+		UpdateVisibility(io_tracked);
+
+		if (io_state.spill_directory.empty())
+			return;
+
+		//segments with a job in flight are counted as if the job was done
+		size_t resident_bytes = io_tracked.resident_bytes;
+		for (auto const & tracked : io_tracked.segments)
+		{
+			if (tracked.busy)
+				resident_bytes = tracked.unloaded ? resident_bytes + tracked.bytes : resident_bytes - tracked.bytes;
+		}
+
+		size_t const low_water = static_cast<size_t>(static_cast<double>(io_state.budget) * low_water_ratio);
+		std::vector<size_t> order;
+		if (resident_bytes > io_state.budget)
+		{
+			for (size_t i = 0; i < io_tracked.segments.size(); ++i)
+			{
+				if (!io_tracked.segments[i].unloaded && !io_tracked.segments[i].busy)
+					order.push_back(i);
+			}
+			std::vector<TrackedSegment> const & segments = io_tracked.segments;
+			std::sort(order.begin(), order.end(), [&segments](size_t a, size_t b)
+			{
+				TrackedSegment const & first = segments[a];
+				TrackedSegment const & second = segments[b];
+				if ((first.coverage > 0) != (second.coverage > 0))
+					return first.coverage <= 0;
+				if (first.coverage <= 0)
+					return first.last_visible < second.last_visible;
+				return first.coverage < second.coverage;
+			});
+
+			for (size_t i : order)
+			{
+				if (resident_bytes <= low_water)
+					break;
+				AddJob(io_tracked, i, false, io_state, io_jobs);
+				resident_bytes -= io_tracked.segments[i].bytes;
+			}
+		}
+		else
+		{
+			for (size_t i = 0; i < io_tracked.segments.size(); ++i)
+			{
+				if (io_tracked.segments[i].unloaded && !io_tracked.segments[i].busy && io_tracked.segments[i].coverage > 0)
+					order.push_back(i);
+			}
+			std::vector<TrackedSegment> const & segments = io_tracked.segments;
+			std::sort(order.begin(), order.end(), [&segments](size_t a, size_t b) { return segments[a].coverage > segments[b].coverage; });
+
+			size_t loads = 0;
+			for (size_t i : order)
+			{
+				if (loads == max_loads_per_apply)
+					break;
+				if (resident_bytes + io_tracked.segments[i].bytes > low_water)
+					continue;
+				AddJob(io_tracked, i, true, io_state, io_jobs);
+				resident_bytes += io_tracked.segments[i].bytes;
+				++loads;
+			}
+		}
+	}
+
+	//records the outcome of a job, and returns the model if its segment was unloaded or loaded back
+	TrackedModel * CommitJob(SpillJob const & in_job, BudgetState & io_state)
+	{
+		auto model = io_state.models.find(in_job.model);
+		if (model == io_state.models.end() || in_job.index >= model->second.segments.size() ||
+			model->second.segments[in_job.index].segment != in_job.segment)
+		{
+			//the model was untracked while the job ran, unloaded shells are not loaded back
+			if (in_job.succeeded && !in_job.load)
+				std::remove(in_job.spill_file.c_str());
+			return nullptr;
+		}
+
+		TrackedModel & tracked_model = model->second;
+		TrackedSegment & tracked = tracked_model.segments[in_job.index];
+		tracked.busy = false;
+		if (!in_job.succeeded)
+			return nullptr;
+
+		if (in_job.load)
+		{
+			tracked.unloaded = false;
+			tracked.spill_file.clear();
+			tracked.proxy = SegmentKey();
+			tracked_model.resident_bytes += tracked.bytes;
+		}
+		else
+		{
+			tracked.unloaded = true;
+			tracked.spill_file = in_job.spill_file;
+			tracked.proxy = in_job.proxy;
+			tracked_model.resident_bytes -= tracked.bytes;
+		}
+		return &tracked_model;
+	}
+
+	//carries out the jobs without holding the lock, and returns the views of the models which changed
+	std::vector<View> ExecuteJobs(std::vector<SpillJob> & io_jobs)
+	{
+		for (auto & job : io_jobs)
+		{
+			try
+			{
+				job.succeeded = job.load ? Load(job) : Unload(job);
+			}
+			catch (InvalidObjectException const &)
+			{
+				//the model was deleted while the job ran
+				job.succeeded = false;
+			}
+		}
+
+		std::vector<Model> changed_models;
+		std::vector<View> changed_views;
+		{
+			BudgetState & state = GetBudgetState();
+			std::lock_guard<std::mutex> lock(state.mutex);
+			std::unordered_set<Key, KeyHasher> changed;
+			for (auto const & job : io_jobs)
+			{
+				TrackedModel * tracked = CommitJob(job, state);
+				if (tracked && changed.insert(job.model).second)
+				{
+					changed_models.push_back(tracked->model);
+					changed_views.push_back(tracked->view);
+				}
+			}
+		}
+
+		for (auto const & model : changed_models)
+			InvalidateCaches(model);
+		return changed_views;
+	}
+
+	//hands the jobs to a new worker, which waits for the previous one so that the spill files are handled one job list at a time
+	void StartWorker(std::vector<SpillJob> const & in_jobs, BudgetState & io_state)
+	{
+		std::thread previous_worker = std::move(io_state.worker);
+		++io_state.applying;
+		io_state.worker = std::thread([jobs = in_jobs, previous_worker = std::move(previous_worker)]() mutable
+		{
+			if (previous_worker.joinable())
+				previous_worker.join();
+
+			std::vector<View> views = ExecuteJobs(jobs);
+
+			BudgetState & state = GetBudgetState();
+			std::lock_guard<std::mutex> lock(state.mutex);
+			state.pending_updates.insert(state.pending_updates.end(), views.begin(), views.end());
+			--state.applying;
+		});
+	}
+
+	//waits for the jobs in flight, which may be writing into a model which is about to be deleted
+	void JoinWorker()
+	{
+		std::thread worker;
+		{
+			BudgetState & state = GetBudgetState();
+			std::lock_guard<std::mutex> lock(state.mutex);
+			worker = std::move(state.worker);
+		}
+		if (worker.joinable())
+			worker.join();
+	}
+
+	void ForgetModel(TrackedModel & io_tracked)
+	{
+		for (auto const & tracked : io_tracked.segments)
+		{
+			if (!tracked.spill_file.empty())
+				std::remove(tracked.spill_file.c_str());
+		}
+	}
+
+	EventHandler::HandleResult BudgetEventHandler::Handle(Event const *)
+	{
+		std::vector<View> updates;
+		{
+			BudgetState & state = GetBudgetState();
+			std::lock_guard<std::mutex> lock(state.mutex);
+			updates.swap(state.pending_updates);
+
+			std::vector<SpillJob> jobs;
+			Clock::time_point const now = Clock::now();
+			for (auto it = state.models.begin(); it != state.models.end();)
+			{
+				TrackedModel & tracked = it->second;
+				if (tracked.view.Type() == HPS::Type::None || tracked.model.Type() == HPS::Type::None)
+				{
+					//the model was deleted without being untracked
+					ForgetModel(tracked);
+					it = state.models.erase(it);
+					continue;
+				}
+
+				CameraKit camera;
+				tracked.view.GetSegmentKey().ShowCamera(camera);
+				if (!camera.Equals(tracked.camera))
+				{
+					tracked.camera = camera;
+					tracked.camera_change = now;
+					tracked.settled = false;
+				}
+				else if (!tracked.settled && !tracked.held && state.applying == 0 && std::chrono::duration<float>(now - tracked.camera_change).count() >= settle_delay)
+					PlanBudget(tracked, state, jobs);
+				++it;
+			}
+
+			//reading and writing the spill files is slow, the worker does it while the ticks keep coming
+			if (!jobs.empty())
+				StartWorker(jobs, state);
+		}
+
+		for (auto & view : updates)
+		{
+			if (view.Type() != HPS::Type::None)
+				view.Update();
+		}
+
+		//timer ticks are also needed by the operators
+		return HandleResult::NotHandled;
+	}
+}
+
+bool HPS::MemoryBudget::Track(HPS::View const & in_view)
+{
+	if (in_view.Type() == HPS::Type::None)
+		return false;
+	Model model = in_view.GetAttachedModel();
+	if (model.Type() == HPS::Type::None)
+		return false;
+	Untrack(model);
+
+	TrackedModel tracked;
+	tracked.view = in_view;
+	tracked.model = model;
+	tracked.resident_bytes = 0;
+	tracked.settled = false;
+	tracked.held = false;
+	tracked.camera_change = Clock::now();
+	std::unordered_map<Key, size_t, KeyHasher> indices;
+	Collect(model.GetSegmentKey(), MatrixKit::GetDefault(), indices, tracked.segments);
+	if (tracked.segments.empty())
+		return false;
+	for (auto & segment : tracked.segments)
+	{
+		segment.last_visible = tracked.camera_change;
+		tracked.resident_bytes += segment.bytes;
+	}
+
+	BudgetState & state = GetBudgetState();
+	std::lock_guard<std::mutex> lock(state.mutex);
+	state.models[model.GetSegmentKey()] = tracked;
+	if (!state.handler)
+	{
+		state.handler.reset(new BudgetEventHandler());
+		HPS::Database::GetEventDispatcher().Subscribe(*state.handler, Object::ClassID<TimerTickEvent>());
+	}
+	return true;
+}
+
+void HPS::MemoryBudget::Untrack(HPS::Model const & in_model)
+{
+	if (in_model.Type() == HPS::Type::None)
+		return;
+	JoinWorker();
+
+	BudgetState & state = GetBudgetState();
+	std::lock_guard<std::mutex> lock(state.mutex);
+	auto it = state.models.find(in_model.GetSegmentKey());
+	if (it == state.models.end())
+		return;
+	ForgetModel(it->second);
+	state.models.erase(it);
+}
+
+bool HPS::MemoryBudget::Apply(HPS::View const & in_view)
+{
+	if (in_view.Type() == HPS::Type::None)
+		return false;
+	Model model = in_view.GetAttachedModel();
+	if (model.Type() == HPS::Type::None)
+		return false;
+
+	std::vector<SpillJob> jobs;
+	{
+		BudgetState & state = GetBudgetState();
+		std::lock_guard<std::mutex> lock(state.mutex);
+		auto it = state.models.find(model.GetSegmentKey());
+		if (it == state.models.end() || it->second.held)
+			return false;
+		PlanBudget(it->second, state, jobs);
+	}
+	return !ExecuteJobs(jobs).empty();
+}
+
+size_t HPS::MemoryBudget::UnloadHidden()
+{
+	size_t unloaded_bytes = 0;
+	{
+		BudgetState & state = GetBudgetState();
+		std::lock_guard<std::mutex> lock(state.mutex);
+		if (state.spill_directory.empty())
+			return 0;
+
+		std::vector<SpillJob> jobs;
+		for (auto & model : state.models)
+		{
+			TrackedModel & tracked = model.second;
+			if (tracked.held || tracked.view.Type() == HPS::Type::None || tracked.model.Type() == HPS::Type::None)
+				continue;
+
+			UpdateVisibility(tracked);
+			for (size_t i = 0; i < tracked.segments.size(); ++i)
+			{
+				TrackedSegment const & segment = tracked.segments[i];
+				if (!segment.unloaded && !segment.busy && segment.coverage <= 0)
+				{
+					AddJob(tracked, i, false, state, jobs);
+					unloaded_bytes += segment.bytes;
+				}
+			}
+		}
+
+		//called when memory is short, which is no time to wait for the files to be written
+		if (!jobs.empty())
+			StartWorker(jobs, state);
+	}
+	return unloaded_bytes;
+}
+
+bool HPS::MemoryBudget::LoadAll(HPS::Model const & in_model)
+{
+	if (in_model.Type() == HPS::Type::None)
+		return false;
+
+	BudgetState & state = GetBudgetState();
+	{
+		std::lock_guard<std::mutex> lock(state.mutex);
+		auto it = state.models.find(in_model.GetSegmentKey());
+		if (it == state.models.end())
+			return true;
+		//no new jobs are planned for the model from now on
+		it->second.held = true;
+	}
+	JoinWorker();
+
+	std::vector<SpillJob> jobs;
+	{
+		std::lock_guard<std::mutex> lock(state.mutex);
+		auto it = state.models.find(in_model.GetSegmentKey());
+		if (it == state.models.end())
+			return true;
+		TrackedModel & tracked = it->second;
+		for (size_t i = 0; i < tracked.segments.size(); ++i)
+		{
+			if (tracked.segments[i].unloaded)
+				AddJob(tracked, i, true, state, jobs);
+		}
+	}
+	if (jobs.empty())
+		return true;
+
+	std::vector<View> views = ExecuteJobs(jobs);
+	std::lock_guard<std::mutex> lock(state.mutex);
+	state.pending_updates.insert(state.pending_updates.end(), views.begin(), views.end());
+	return std::all_of(jobs.begin(), jobs.end(), [](SpillJob const & in_job) { return in_job.succeeded; });
+}
+
+void HPS::MemoryBudget::Resume(HPS::Model const & in_model)
+{
+	if (in_model.Type() == HPS::Type::None)
+		return;
+
+	BudgetState & state = GetBudgetState();
+	std::lock_guard<std::mutex> lock(state.mutex);
+	auto it = state.models.find(in_model.GetSegmentKey());
+	if (it == state.models.end())
+		return;
+	it->second.held = false;
+	//apply the budget as soon as the next tick
+	it->second.settled = false;
+}
+
+void HPS::MemoryBudget::Shutdown()
+{
+	std::unique_ptr<BudgetEventHandler> handler;
+	std::thread worker;
+	BudgetState & state = GetBudgetState();
+	{
+		std::lock_guard<std::mutex> lock(state.mutex);
+		for (auto & model : state.models)
+			ForgetModel(model.second);
+		state.models.clear();
+		handler = std::move(state.handler);
+		worker = std::move(state.worker);
+	}
+	//the handler unsubscribes when destroyed, outside of the lock since it may be handling a tick
+	handler.reset();
+
+	//the jobs in flight find their model untracked and delete their files
+	if (worker.joinable())
+		worker.join();
+	std::lock_guard<std::mutex> lock(state.mutex);
+	state.pending_updates.clear();
+}
+
+void HPS::MemoryBudget::SetBudget(size_t in_bytes)
+{
+	BudgetState & state = GetBudgetState();
+	std::lock_guard<std::mutex> lock(state.mutex);
+	state.budget = in_bytes;
+	//apply the new budget as soon as the next tick
+	for (auto & model : state.models)
+		model.second.settled = false;
+}
+
+size_t HPS::MemoryBudget::GetBudget()
+{
+	BudgetState & state = GetBudgetState();
+	std::lock_guard<std::mutex> lock(state.mutex);
+	return state.budget;
+}
+
+void HPS::MemoryBudget::SetSpillDirectory(char const * in_directory)
+{
+	BudgetState & state = GetBudgetState();
+	std::lock_guard<std::mutex> lock(state.mutex);
+	state.spill_directory = in_directory ? in_directory : "";
+}
+
+size_t HPS::MemoryBudget::GetResidentBytes(HPS::Model const & in_model)
+{
+	if (in_model.Type() == HPS::Type::None)
+		return 0;
+
+	BudgetState & state = GetBudgetState();
+	std::lock_guard<std::mutex> lock(state.mutex);
+	auto it = state.models.find(in_model.GetSegmentKey());
+	if (it == state.models.end())
+		return 0;
+	return it->second.resident_bytes;
+}
+
+size_t HPS::MemoryBudget::GetUnloadedBytes(HPS::Model const & in_model)
+{
+	if (in_model.Type() == HPS::Type::None)
+		return 0;
+
+	BudgetState & state = GetBudgetState();
+	std::lock_guard<std::mutex> lock(state.mutex);
+	auto it = state.models.find(in_model.GetSegmentKey());
+	if (it == state.models.end())
+		return 0;
+
+	size_t unloaded_bytes = 0;
+	for (auto const & segment : it->second.segments)
+	{
+		//the shells of a segment being unloaded are already out of the model
+		if (segment.unloaded || segment.busy)
+			unloaded_bytes += segment.bytes;
+	}
+	return unloaded_bytes;
+}
+
+bool HPS::MemoryBudget::IsProxySegment(HPS::SegmentKey const & in_segment)
+{
+	return in_segment.Name() == budget_proxy_name;
+}
@@ -0,0 +1,402 @@
+// Copyright (c) Tech Soft 3D, Inc.
+//
+// The information contained herein is confidential and proprietary to Tech Soft 3D, Inc.,
+// and considered a trade secret as defined under civil and criminal statutes.
+// Tech Soft 3D, Inc. shall pursue its civil and criminal remedies in the event of
+// unauthorized use or misappropriation of its trade secrets.  Use of this information
+// by anyone other than authorized employees of Tech Soft 3D, Inc. is granted only under
+// a written non-disclosure agreement, expressly prescribing the scope and manner of such use.
+
+#include "sprk_ops.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <queue>
+
+using namespace HPS;
+
+namespace
+{
+	//weight of the planes which keep open borders in place, relative to the planes of the faces
+	const double boundary_weight = 1000.0;
+
+	//symmetric 4x4 matrix measuring the squared distance of a point to a set of planes
+	struct Quadric
+	{
+		Quadric()
+		{
+			std::fill(m, m + 10, 0.0);
+		}
+
+		void AddPlane(double a, double b, double c, double d, double weight)
+		{
+			m[0] += weight * a * a;	m[1] += weight * a * b;	m[2] += weight * a * c;	m[3] += weight * a * d;
+			m[4] += weight * b * b;	m[5] += weight * b * c;	m[6] += weight * b * d;
+			m[7] += weight * c * c;	m[8] += weight * c * d;
+			m[9] += weight * d * d;
+		}
+
+		void Add(Quadric const & in_that)
+		{
+			for (int i = 0; i < 10; ++i)
+				m[i] += in_that.m[i];
+		}
+
+		double Error(Point const & p) const
+		{
+			double const x = p.x, y = p.y, z = p.z;
+			return m[0] * x * x + 2 * m[1] * x * y + 2 * m[2] * x * z + 2 * m[3] * x
+				+ m[4] * y * y + 2 * m[5] * y * z + 2 * m[6] * y
+				+ m[7] * z * z + 2 * m[8] * z
+				+ m[9];
+		}
+
+		bool Optimum(Point & out_point) const
+		{
+			double const det = m[0] * (m[4] * m[7] - m[5] * m[5]) - m[1] * (m[1] * m[7] - m[5] * m[2]) + m[2] * (m[1] * m[5] - m[4] * m[2]);
+			double const scale = (std::max)((std::max)(m[0], m[4]), m[7]);
+			if (std::fabs(det) <= 1e-9 * scale * scale * scale)
+				return false;
+
+			//Cramer's rule on the upper 3x3 block, solving for the point where the gradient vanishes
+			double const bx = -m[3], by = -m[6], bz = -m[8];
+			double const x = (bx * (m[4] * m[7] - m[5] * m[5]) - m[1] * (by * m[7] - m[5] * bz) + m[2] * (by * m[5] - m[4] * bz)) / det;
+			double const y = (m[0] * (by * m[7] - bz * m[5]) - bx * (m[1] * m[7] - m[5] * m[2]) + m[2] * (m[1] * bz - by * m[2])) / det;
+			double const z = (m[0] * (m[4] * bz - m[5] * by) - m[1] * (m[1] * bz - by * m[2]) + bx * (m[1] * m[5] - m[4] * m[2])) / det;
+			out_point = Point(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z));
+			return true;
+		}
+
+		double				m[10];
+	};
+
+	struct Candidate
+	{
+		double				cost;
+		uint32_t			first;
+		uint32_t			second;
+		uint32_t			first_stamp;
+		uint32_t			second_stamp;
+		Point				target;
+
+		bool operator>(Candidate const & in_that) const
+		{
+			return cost > in_that.cost;
+		}
+	};
+
+	class EdgeCollapseMesh
+	{
+	public:
+		EdgeCollapseMesh(PointArray const & in_points, IntArray const & in_facelist);
+
+		size_t				TriangleCount() const { return live_triangles; }
+		void				Collapse(size_t in_target_triangles, std::atomic<bool> const * in_cancel);
+		void				Emit(MeshDecimator::Level & out_level) const;
+
+	private:
+		void				PushCandidate(uint32_t in_first, uint32_t in_second);
+		bool				Flips(uint32_t in_vertex, uint32_t in_other, Point const & in_target) const;
+
+		std::vector<Point>						positions;
+		std::vector<Quadric>					quadrics;
+		std::vector<uint32_t>					stamps;			//incremented each time a vertex moves, to discard the candidates queued before
+		std::vector<bool>						removed;
+		std::vector<std::vector<uint32_t>>		vertex_triangles;
+		std::vector<uint32_t>					triangles;
+		std::vector<bool>						dead;
+		size_t									live_triangles;
+		std::priority_queue<Candidate, std::vector<Candidate>, std::greater<Candidate>>	candidates;
+	};
+
+	EdgeCollapseMesh::EdgeCollapseMesh(PointArray const & in_points, IntArray const & in_facelist)
+		: live_triangles(0)
+	{
+		//shells usually split vertices along creases, weld them so that the collapses see the real topology
+		std::vector<uint32_t> order(in_points.size());
+		for (uint32_t i = 0; i < order.size(); ++i)
+			order[i] = i;
+		std::sort(order.begin(), order.end(), [&in_points](uint32_t a, uint32_t b)
+		{
+			Point const & p = in_points[a];
+			Point const & q = in_points[b];
+			if (p.x != q.x)
+				return p.x < q.x;
+			if (p.y != q.y)
+				return p.y < q.y;
+			return p.z < q.z;
+		});
+		std::vector<uint32_t> welded(in_points.size());
+		for (size_t i = 0; i < order.size(); ++i)
+		{
+			if (i == 0 || in_points[order[i]] != in_points[order[i - 1]])
+				positions.push_back(in_points[order[i]]);
+			welded[order[i]] = static_cast<uint32_t>(positions.size() - 1);
+		}
+
+		size_t i = 0;
+		while (i < in_facelist.size())
+		{
+			int const count = in_facelist[i++];
+			//holes do not change which points the face covers, skip them
+			if (count > 0)
+			{
+				for (int j = 1; j + 1 < count; ++j)
+				{
+					uint32_t const a = welded[in_facelist[i]];
+					uint32_t const b = welded[in_facelist[i + j]];
+					uint32_t const c = welded[in_facelist[i + j + 1]];
+					if (a != b && b != c && a != c)
+					{
+						triangles.push_back(a);
+						triangles.push_back(b);
+						triangles.push_back(c);
+					}
+				}
+			}
+			i += static_cast<size_t>(count < 0 ? -count : count);
+		}
+
+		size_t const triangle_count = triangles.size() / 3;
+		live_triangles = triangle_count;
+		dead.assign(triangle_count, false);
+		quadrics.resize(positions.size());
+		stamps.assign(positions.size(), 0);
+		removed.assign(positions.size(), false);
+		vertex_triangles.resize(positions.size());
+
+		std::vector<uint64_t> edges;
+		edges.reserve(3 * triangle_count);
+		for (uint32_t t = 0; t < triangle_count; ++t)
+		{
+			uint32_t const * corners = &triangles[3 * t];
+			Vector const normal = Vector(positions[corners[1]] - positions[corners[0]]).Cross(positions[corners[2]] - positions[corners[0]]);
+			double const length = normal.Length();
+			if (length > 0)
+			{
+				//the length of the cross product is twice the area, which weights the plane by the size of the face
+				double const a = normal.x / length, b = normal.y / length, c = normal.z / length;
+				double const d = -(a * positions[corners[0]].x + b * positions[corners[0]].y + c * positions[corners[0]].z);
+				for (int k = 0; k < 3; ++k)
+					quadrics[corners[k]].AddPlane(a, b, c, d, 0.5 * length);
+			}
+
+			for (int k = 0; k < 3; ++k)
+			{
+				vertex_triangles[corners[k]].push_back(t);
+				uint32_t const first = (std::min)(corners[k], corners[(k + 1) % 3]);
+				uint32_t const second = (std::max)(corners[k], corners[(k + 1) % 3]);
+				edges.push_back(static_cast<uint64_t>(first) << 32 | second);
+			}
+		}
+
+		std::sort(edges.begin(), edges.end());
+		for (size_t e = 0; e < edges.size();)
+		{
+			size_t next = e + 1;
+			while (next < edges.size() && edges[next] == edges[e])
+				++next;
+
+			uint32_t const first = static_cast<uint32_t>(edges[e] >> 32);
+			uint32_t const second = static_cast<uint32_t>(edges[e] & 0xffffffff);
+			if (next - e == 1)
+			{
+				//an edge used by a single face is on an open border, add a plane through it perpendicular to the face
+				for (uint32_t t : vertex_triangles[first])
+				{
+					uint32_t const * corners = &triangles[3 * t];
+					if (corners[0] != second && corners[1] != second && corners[2] != second)
+						continue;
+					Vector const face_normal = Vector(positions[corners[1]] - positions[corners[0]]).Cross(positions[corners[2]] - positions[corners[0]]);
+					Vector const edge = positions[second] - positions[first];
+					Vector normal = edge.Cross(face_normal);
+					double const length = normal.Length();
+					if (length > 0)
+					{
+						double const a = normal.x / length, b = normal.y / length, c = normal.z / length;
+						double const d = -(a * positions[first].x + b * positions[first].y + c * positions[first].z);
+						double const weight = boundary_weight * edge.Length() * edge.Length();
+						quadrics[first].AddPlane(a, b, c, d, weight);
+						quadrics[second].AddPlane(a, b, c, d, weight);
+					}
+					break;
+				}
+			}
+			e = next;
+		}
+
+		for (size_t e = 0; e < edges.size(); ++e)
+		{
+			if (e == 0 || edges[e] != edges[e - 1])
+				PushCandidate(static_cast<uint32_t>(edges[e] >> 32), static_cast<uint32_t>(edges[e] & 0xffffffff));
+		}
+	}
+
+	void EdgeCollapseMesh::PushCandidate(uint32_t in_first, uint32_t in_second)
+	{
+		Quadric quadric = quadrics[in_first];
+		quadric.Add(quadrics[in_second]);
+
+		Candidate candidate;
+		candidate.first = in_first;
+		candidate.second = in_second;
+		candidate.first_stamp = stamps[in_first];
+		candidate.second_stamp = stamps[in_second];
+		if (quadric.Optimum(candidate.target))
+			candidate.cost = quadric.Error(candidate.target);
+		else
+		{
+			//the planes do not meet in a single point, try the ends and the middle of the edge
+			Point const options[3] = { positions[in_first], positions[in_second], Midpoint(positions[in_first], positions[in_second]) };
+			candidate.cost = (std::numeric_limits<double>::max)();
+			for (auto const & option : options)
+			{
+				double const cost = quadric.Error(option);
+				if (cost < candidate.cost)
+				{
+					candidate.cost = cost;
+					candidate.target = option;
+				}
+			}
+		}
+		candidates.push(candidate);
+	}
+
+	bool EdgeCollapseMesh::Flips(uint32_t in_vertex, uint32_t in_other, Point const & in_target) const
+	{
+		for (uint32_t t : vertex_triangles[in_vertex])
+		{
+			if (dead[t])
+				continue;
+			uint32_t const * corners = &triangles[3 * t];
+			if (corners[0] == in_other || corners[1] == in_other || corners[2] == in_other)
+				continue;
+
+			Point moved[3] = { positions[corners[0]], positions[corners[1]], positions[corners[2]] };
+			for (int k = 0; k < 3; ++k)
+			{
+				if (corners[k] == in_vertex)
+					moved[k] = in_target;
+			}
+			Vector const before = Vector(positions[corners[1]] - positions[corners[0]]).Cross(positions[corners[2]] - positions[corners[0]]);
+			Vector const after = Vector(moved[1] - moved[0]).Cross(moved[2] - moved[0]);
+			if (before.Dot(after) <= 0)
+				return true;
+		}
+		return false;
+	}
+
+	void EdgeCollapseMesh::Collapse(size_t in_target_triangles, std::atomic<bool> const * in_cancel)
+	{
+		size_t iterations = 0;
+		while (live_triangles > in_target_triangles && !candidates.empty())
+		{
+			if (in_cancel && (++iterations & 0xfff) == 0 && *in_cancel)
+				return;
+
+			Candidate const candidate = candidates.top();
+			candidates.pop();
+
+			uint32_t const keep = candidate.first;
+			uint32_t const drop = candidate.second;
+			if (removed[keep] || removed[drop] || stamps[keep] != candidate.first_stamp || stamps[drop] != candidate.second_stamp)
+				continue;
+			if (Flips(keep, drop, candidate.target) || Flips(drop, keep, candidate.target))
+				continue;
+
+			positions[keep] = candidate.target;
+			quadrics[keep].Add(quadrics[drop]);
+			removed[drop] = true;
+			++stamps[keep];
+
+			for (uint32_t t : vertex_triangles[drop])
+			{
+				if (dead[t])
+					continue;
+				uint32_t * corners = &triangles[3 * t];
+				if (corners[0] == keep || corners[1] == keep || corners[2] == keep)
+				{
+					dead[t] = true;
+					--live_triangles;
+					continue;
+				}
+				for (int k = 0; k < 3; ++k)
+				{
+					if (corners[k] == drop)
+						corners[k] = keep;
+				}
+				vertex_triangles[keep].push_back(t);
+			}
+			std::vector<uint32_t>().swap(vertex_triangles[drop]);
+
+			//drop the faces which collapsed and queue the edges around the vertex again
+			std::vector<uint32_t> & around = vertex_triangles[keep];
+			around.erase(std::remove_if(around.begin(), around.end(), [this](uint32_t t) { return dead[t]; }), around.end());
+			std::vector<uint32_t> neighbors;
+			for (uint32_t t : around)
+			{
+				for (int k = 0; k < 3; ++k)
+				{
+					uint32_t const corner = triangles[3 * t + k];
+					if (corner != keep)
+						neighbors.push_back(corner);
+				}
+			}
+			std::sort(neighbors.begin(), neighbors.end());
+			neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+			for (uint32_t neighbor : neighbors)
+				PushCandidate((std::min)(keep, neighbor), (std::max)(keep, neighbor));
+		}
+	}
+
+	void EdgeCollapseMesh::Emit(MeshDecimator::Level & out_level) const
+	{
+		out_level.points.clear();
+		out_level.facelist.clear();
+		out_level.facelist.reserve(4 * live_triangles);
+
+		std::vector<int> remap(positions.size(), -1);
+		for (size_t t = 0; t < dead.size(); ++t)
+		{
+			if (dead[t])
+				continue;
+			out_level.facelist.push_back(3);
+			for (int k = 0; k < 3; ++k)
+			{
+				uint32_t const corner = triangles[3 * t + k];
+				if (remap[corner] < 0)
+				{
+					remap[corner] = static_cast<int>(out_level.points.size());
+					out_level.points.push_back(positions[corner]);
+				}
+				out_level.facelist.push_back(remap[corner]);
+			}
+		}
+	}
+}
+
+bool HPS::MeshDecimator::Decimate(HPS::PointArray const & in_points, HPS::IntArray const & in_facelist, HPS::FloatArray const & in_ratios,
+								  LevelArray & out_levels, std::atomic<bool> const * in_cancel)
+{
+	out_levels.clear();
+
+	EdgeCollapseMesh mesh(in_points, in_facelist);
+	size_t const triangle_count = mesh.TriangleCount();
+	if (triangle_count == 0)
+		return false;
+
+	out_levels.resize(in_ratios.size());
+	for (size_t i = 0; i < in_ratios.size(); ++i)
+	{
+		size_t const target = static_cast<size_t>(static_cast<double>(triangle_count) * (std::max)(in_ratios[i], 0.0f));
+		mesh.Collapse(target, in_cancel);
+		if (in_cancel && *in_cancel)
+		{
+			out_levels.clear();
+			return false;
+		}
+		mesh.Emit(out_levels[i]);
+	}
+	return true;
+}
@@ -22,10 +22,8 @@ void HPS::MouseWheelOperator::UpdateZoomLimit()
 {
 	HPS::SimpleSphere sphere;
 	HPS::SimpleCuboid bounds;
-	HPS::BoundingKit bkit;
 	
-	if(GetAttachedView().GetAttachedModel().GetSegmentKey().ShowBounding(bkit)
-		&& bkit.ShowVolume(sphere,bounds))
+	if(BoundingCache::ShowVolume(GetAttachedView().GetAttachedModel().GetSegmentKey(), sphere, bounds))
 	{
 		HPS::Vector delta = bounds.max - bounds.min;
 		zoom_limit = static_cast<float>(delta.Length()) * 0.0002f;
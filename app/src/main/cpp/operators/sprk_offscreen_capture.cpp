@@ -0,0 +1,313 @@
+// Copyright (c) Tech Soft 3D, Inc.
+//
+// The information contained herein is confidential and proprietary to Tech Soft 3D, Inc.,
+// and considered a trade secret as defined under civil and criminal statutes.
+// Tech Soft 3D, Inc. shall pursue its civil and criminal remedies in the event of
+// unauthorized use or misappropriation of its trade secrets.  Use of this information
+// by anyone other than authorized employees of Tech Soft 3D, Inc. is granted only under
+// a written non-disclosure agreement, expressly prescribing the scope and manner of such use.
+
+#include "sprk_ops.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+using namespace HPS;
+
+namespace
+{
+	const unsigned int default_max_tile_size = 2048;
+	const float degrees_per_radian = 57.29578f;
+
+	struct CaptureState
+	{
+		CaptureState() : max_tile_size(default_max_tile_size), busy(false) {}
+
+		~CaptureState()
+		{
+			if (worker.joinable())
+				worker.join();
+		}
+
+		std::mutex			mutex;
+		std::thread			worker;
+		unsigned int		max_tile_size;
+		bool				busy;
+		std::shared_ptr<std::atomic<bool>>	cancel;		//of the capture in progress
+	};
+
+	CaptureState & GetCaptureState()
+	{
+		static CaptureState capture_state;
+		return capture_state;
+	}
+
+	struct CaptureRequest
+	{
+		View					view;
+		UTF8					file_name;
+		unsigned int			width;
+		unsigned int			height;
+		Image::Format			format;
+		OffscreenCapture::Callback	callback;
+		Window::Driver			driver;
+		unsigned int			max_tile_size;
+		std::shared_ptr<std::atomic<bool>>	cancel;
+	};
+
+	//the field of a camera is the smallest area the window shows, the window widens it to its own aspect ratio
+	void WidenField(CameraKit & io_camera, unsigned int in_width, unsigned int in_height)
+	{
+		float field_width, field_height;
+		if (!io_camera.ShowField(field_width, field_height) || field_width <= 0 || field_height <= 0)
+			return;
+
+		float const image_aspect = static_cast<float>(in_width) / static_cast<float>(in_height);
+		if (image_aspect > field_width / field_height)
+			field_width = field_height * image_aspect;
+		else
+			field_height = field_width / image_aspect;
+		io_camera.SetField(field_width, field_height);
+	}
+
+	bool ToWorld(KeyPath const & in_path, Coordinate::Space in_space, Point const & in_point, Point & out_point)
+	{
+		return in_path.ConvertCoordinate(in_space, in_point, Coordinate::Space::World, out_point);
+	}
+
+	/*! Sets the camera of a tile on the capture segment. Perspective tiles keep the eye point and target of the view, the field
+	 *  is scaled down to the tile and the oblique skew turns the window of the tile off the axis, so that every tile is seen from
+	 *  the same point and they join without parallax. Parallel projections have no eye point, their tiles are shifted instead. */
+	void SetTileCamera(SegmentKey & in_capture, CameraKit const & in_camera, Vector const & in_right, Vector const & in_up,
+					   unsigned int in_width, unsigned int in_height, unsigned int in_left, unsigned int in_top, unsigned int in_tile_width, unsigned int in_tile_height)
+	{
+		Point position, target;
+		float field_width, field_height;
+		Camera::Projection projection;
+		in_camera.ShowPosition(position);
+		in_camera.ShowTarget(target);
+		in_camera.ShowField(field_width, field_height);
+		in_camera.ShowProjection(projection);
+
+		float const center_x = in_left + 0.5f * in_tile_width;
+		float const center_y = in_top + 0.5f * in_tile_height;
+		float const offset_x = field_width * (center_x / in_width - 0.5f);
+		float const offset_y = field_height * (0.5f - center_y / in_height);
+
+		CameraKit tile = in_camera;
+		tile.SetField(field_width * in_tile_width / in_width, field_height * in_tile_height / in_height);
+
+		if (projection == Camera::Projection::Perspective)
+		{
+			//the skew is the angle between the axis of the view and the center of the tile, seen from the eye point
+			float const distance = static_cast<float>(Vector(target - position).Length());
+			float const skew_x = std::atan(offset_x / distance) * degrees_per_radian;
+			float const skew_y = std::atan(offset_y / distance) * degrees_per_radian;
+			tile.SetProjection(Camera::Projection::Perspective, skew_y, skew_x);
+		}
+		else
+		{
+			Vector const offset = in_right * offset_x + in_up * offset_y;
+			tile.SetPosition(position + offset);
+			tile.SetTarget(target + offset);
+		}
+		in_capture.SetCamera(tile);
+	}
+
+	bool RenderTiles(CaptureRequest const & in_request, ByteArray & out_pixels)
+	{
+		CameraKit camera;
+		if (!in_request.view.GetSegmentKey().ShowCamera(camera))
+			return false;
+		WidenField(camera, in_request.width, in_request.height);
+
+		unsigned int const tile_size = (std::min)(in_request.max_tile_size, (std::max)(in_request.width, in_request.height));
+		unsigned int const tile_width = (std::min)(tile_size, in_request.width);
+		unsigned int const tile_height = (std::min)(tile_size, in_request.height);
+
+		//the offscreen window draws into an image definition, which is where the pixels of each tile are read from
+		PortfolioKey portfolio = Database::CreatePortfolio();
+		ImageKit target_image;
+		target_image.SetSize(tile_width, tile_height).SetFormat(Image::Format::RGBA).SetData(ByteArray(static_cast<size_t>(tile_width) * tile_height * 4, 0));
+		ImageDefinition target = portfolio.DefineImage("capture", target_image);
+
+		OffScreenWindowOptionsKit options;
+		options.SetDriver(in_request.driver).SetAntiAliasCapable(true);
+		OffScreenWindowKey window = Database::CreateOffScreenWindow(target, options);
+
+		//the copy shares the model through its include, but gets its own camera. Conditions are dropped so that
+		//interaction proxies are not captured
+		SegmentKey capture(in_request.view.GetSegmentKey().CopyTo(window));
+		capture.GetConditionControl().UnsetEverything();
+		capture.SetCamera(camera);
+		KeyPath const path(KeyArray{ capture, window });
+
+		bool success = false;
+		Point origin, right_point, up_point;
+		if (ToWorld(path, Coordinate::Space::Camera, Point(0, 0, 0), origin) &&
+			ToWorld(path, Coordinate::Space::Camera, Point(1, 0, 0), right_point) &&
+			ToWorld(path, Coordinate::Space::Camera, Point(0, 1, 0), up_point))
+		{
+			Vector right = right_point - origin;
+			Vector up = up_point - origin;
+			right.Normalize();
+			up.Normalize();
+
+			size_t const row_bytes = static_cast<size_t>(in_request.width) * 4;
+			out_pixels.assign(row_bytes * in_request.height, 0);
+			success = true;
+			for (unsigned int top = 0; success && top < in_request.height; top += tile_height)
+			{
+				for (unsigned int left = 0; success && left < in_request.width; left += tile_width)
+				{
+					if (*in_request.cancel)
+					{
+						success = false;
+						break;
+					}
+
+					SetTileCamera(capture, camera, right, up, in_request.width, in_request.height, left, top, tile_width, tile_height);
+					UpdateNotifier notifier = window.UpdateWithNotifier(Window::UpdateType::Complete);
+					notifier.Wait();
+					if (notifier.Status() != Window::UpdateStatus::Completed)
+					{
+						success = false;
+						break;
+					}
+
+					ImageKit tile_image;
+					ByteArray tile_pixels;
+					target.Show(tile_image);
+					if (!tile_image.ShowData(tile_pixels) || tile_pixels.size() < static_cast<size_t>(tile_width) * tile_height * 4)
+					{
+						success = false;
+						break;
+					}
+
+					//edge tiles are rendered at full size, only the part inside of the image is kept
+					unsigned int const copy_width = (std::min)(tile_width, in_request.width - left);
+					unsigned int const copy_height = (std::min)(tile_height, in_request.height - top);
+					for (unsigned int row = 0; row < copy_height; ++row)
+					{
+						std::memcpy(&out_pixels[(top + row) * row_bytes + left * 4],
+									&tile_pixels[static_cast<size_t>(row) * tile_width * 4],
+									static_cast<size_t>(copy_width) * 4);
+					}
+				}
+			}
+		}
+
+		window.Delete();
+		portfolio.Delete();
+		return success;
+	}
+
+	void RunCapture(CaptureRequest const & in_request)
+	{
+		bool success = false;
+		try
+		{
+			ByteArray pixels;
+			if (RenderTiles(in_request, pixels))
+			{
+				//encoding happens here, on the capture thread, rather than through an export of the window
+				ImageKit raw;
+				raw.SetSize(in_request.width, in_request.height).SetFormat(Image::Format::RGBA).SetData(pixels);
+				ByteArray().swap(pixels);
+				Image::File::Export(in_request.file_name, ImageKit(raw, in_request.format));
+				success = true;
+			}
+		}
+		catch (HPS::Exception const &)
+		{
+			success = false;
+		}
+
+		{
+			CaptureState & state = GetCaptureState();
+			std::lock_guard<std::mutex> lock(state.mutex);
+			state.busy = false;
+			state.cancel.reset();
+		}
+
+		if (in_request.callback)
+			in_request.callback(success, in_request.file_name);
+	}
+}
+
+bool HPS::OffscreenCapture::Start(HPS::View const & in_view, char const * in_file_name, unsigned int in_width, unsigned int in_height, HPS::Image::Format in_format,
+								  Callback const & in_callback, HPS::Window::Driver in_driver)
+{
+	if (in_view.Type() == HPS::Type::None || in_file_name == nullptr || in_width == 0 || in_height == 0)
+		return false;
+
+	CaptureState & state = GetCaptureState();
+	std::thread previous;
+	{
+		std::lock_guard<std::mutex> lock(state.mutex);
+		if (state.busy)
+			return false;
+		state.busy = true;
+		previous = std::move(state.worker);
+	}
+	//the previous capture is over, its thread only needs to be reclaimed
+	if (previous.joinable())
+		previous.join();
+
+	CaptureRequest request;
+	request.view = in_view;
+	request.file_name = in_file_name;
+	request.width = in_width;
+	request.height = in_height;
+	request.format = in_format;
+	request.callback = in_callback;
+	request.driver = in_driver;
+	request.cancel = std::make_shared<std::atomic<bool>>(false);
+
+	std::lock_guard<std::mutex> lock(state.mutex);
+	request.max_tile_size = state.max_tile_size;
+	state.cancel = request.cancel;
+	state.worker = std::thread(RunCapture, request);
+	return true;
+}
+
+bool HPS::OffscreenCapture::IsBusy()
+{
+	CaptureState & state = GetCaptureState();
+	std::lock_guard<std::mutex> lock(state.mutex);
+	return state.busy;
+}
+
+bool HPS::OffscreenCapture::Cancel()
+{
+	CaptureState & state = GetCaptureState();
+	std::lock_guard<std::mutex> lock(state.mutex);
+	if (!state.cancel)
+		return false;
+	*state.cancel = true;
+	return true;
+}
+
+void HPS::OffscreenCapture::Shutdown()
+{
+	CaptureState & state = GetCaptureState();
+	std::thread worker;
+	{
+		std::lock_guard<std::mutex> lock(state.mutex);
+		worker = std::move(state.worker);
+	}
+	if (worker.joinable())
+		worker.join();
+}
+
+void HPS::OffscreenCapture::SetMaxTileSize(unsigned int in_size)
+{
+	CaptureState & state = GetCaptureState();
+	std::lock_guard<std::mutex> lock(state.mutex);
+	state.max_tile_size = (std::max)(in_size, 1u);
+}
@@ -39,6 +39,7 @@ bool HPS::OrbitOperator::OnMouseMove(MouseState const & in_state)
 {
 	if(operator_active && IsMouseTriggered(in_state) && OrbitCommon(in_state.GetLocation()))
 	{
+		InteractionLOD::BeginInteraction(GetAttachedView());
 		GetAttachedView().Update();
 		return true;
 	}
@@ -102,10 +103,25 @@ bool HPS::OrbitOperator::OnTouchMove(TouchState const & in_state)
     
 	bool ret = OrbitCommon(the_one.Location);
 	if(ret) 
+	{
+		InteractionLOD::BeginInteraction(GetAttachedView());
 		GetAttachedView().Update();
+	}
 	return ret;
 }
 
+bool HPS::OrbitOperator::OnTimerTick(HPS::TimerTickEvent const &)
+{
+	if (InteractionLOD::Tick(GetAttachedView()))
+		GetAttachedView().Update();
+	return false;
+}
+
+void HPS::OrbitOperator::OnViewDetached(HPS::View const & in_detached_view)
+{
+	InteractionLOD::EndInteraction(in_detached_view);
+}
+
 bool HPS::OrbitOperator::OrbitCommon(HPS::WindowPoint const & in_loc)
 {
 	new_point = in_loc;
@@ -120,6 +120,7 @@ bool HPS::PanOrbitZoomOperator::OnMouseMove(MouseState const  & in_state)
 			start_sphere_pos = new_sphere_pos;
 			start_point = new_point;
 		}
+		InteractionLOD::BeginInteraction(GetAttachedView());
 		GetAttachedView().Update();
 		Database::GetEventDispatcher().InjectEvent(CameraChangedEvent(GetAttachedView()));
 		return true;
@@ -275,11 +276,24 @@ bool HPS::PanOrbitZoomOperator::OnTouchMove(TouchState const  & in_state)
 		float zoom_factor = dist - last_zoom.x;
 		UpdateZoom(zoom_factor);
 	}
+	InteractionLOD::BeginInteraction(GetAttachedView());
 	GetAttachedView().Update();
 	Database::GetEventDispatcher().InjectEvent(CameraChangedEvent(GetAttachedView()));
 	return true;
 }
 
+bool HPS::PanOrbitZoomOperator::OnTimerTick(HPS::TimerTickEvent const &)
+{
+	if (InteractionLOD::Tick(GetAttachedView()))
+		GetAttachedView().Update();
+	return false;
+}
+
+void HPS::PanOrbitZoomOperator::OnViewDetached(HPS::View const & in_detached_view)
+{
+	InteractionLOD::EndInteraction(in_detached_view);
+}
+
 void HPS::PanOrbitZoomOperator::ZoomStart()
 {
 	HPS::Point pos;
@@ -354,20 +368,9 @@ void HPS::PanOrbitZoomOperator::UpdateZoomLimit()
 {
 	HPS::SimpleSphere sphere;
 	HPS::SimpleCuboid bounds;
-	HPS::BoundingKit bkit;
-    
-    auto model = GetAttachedView().GetAttachedModel();
-    
-    bool bounding_good = false;
-    
-    if (model.Type() != HPS::Type::None)
-        bounding_good = model.GetSegmentKey().ShowBounding(bkit);
-    else
-        bounding_good = GetAttachedView().GetSegmentKey().ShowBounding(bkit);
     
-    if (bounding_good)
+    if (BoundingCache::ShowVolume(GetAttachedView(), sphere, bounds))
     {
-        bkit.ShowVolume(sphere,bounds);
         HPS::Vector delta = bounds.max - bounds.min;
         zoom_limit = static_cast<float>(delta.Length()) * 0.002f;
     }
@@ -0,0 +1,833 @@
+// Copyright (c) Tech Soft 3D, Inc.
+//
+// The information contained herein is confidential and proprietary to Tech Soft 3D, Inc.,
+// and considered a trade secret as defined under civil and criminal statutes.
+// Tech Soft 3D, Inc. shall pursue its civil and criminal remedies in the event of
+// unauthorized use or misappropriation of its trade secrets.  Use of this information
+// by anyone other than authorized employees of Tech Soft 3D, Inc. is granted only under
+// a written non-disclosure agreement, expressly prescribing the scope and manner of such use.
+
+#include "sprk_ops.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+
+using namespace HPS;
+
+namespace
+{
+	//number of triangles below which a node of the hierarchy is not split any further
+	const uint32_t max_leaf_triangles = 4;
+
+	struct Instance
+	{
+		KeyPath				path;
+		ShellKey			shell;
+	};
+
+	struct Triangle
+	{
+		Point				origin;
+		Vector				edge_one;
+		Vector				edge_two;
+		uint32_t			instance;
+		uint32_t			face;
+	};
+
+	struct Node
+	{
+		float				min[3];
+		float				max[3];
+		uint32_t			first;		//first triangle of the subtree, the triangles of a subtree are contiguous
+		uint32_t			count;		//number of triangles in the subtree
+		uint32_t			right;		//index of the second child, zero for leaves. The first child always follows its parent
+	};
+
+	class Hierarchy
+	{
+	public:
+		bool				Collect(SegmentKey const & in_segment, MatrixKit const & in_parent_matrix, KeyArray & io_path, std::atomic<bool> const & in_cancel);
+		bool				Build(std::atomic<bool> const & in_cancel);
+
+		bool				IntersectRay(Point const & in_origin, Vector const & in_direction, float in_min_parameter, float & out_parameter, uint32_t & out_triangle) const;
+		void				FindInArea(float const * in_world_to_window, Rectangle const & in_area, std::vector<uint32_t> & out_triangles, std::vector<uint32_t> & out_leaves) const;
+		bool				TriangleInArea(uint32_t in_triangle, float const * in_world_to_window, Rectangle const & in_area) const;
+
+		std::vector<Instance>	instances;
+		std::vector<Triangle>	triangles;
+		std::vector<Node>		nodes;
+
+	private:
+		void				AddShell(ShellKey const & in_shell, MatrixKit const & in_matrix, KeyArray const & in_path);
+		uint32_t			BuildNode(uint32_t in_first, uint32_t in_count, std::vector<uint32_t> & io_order, std::vector<Point> const & in_centroids, std::atomic<bool> const & in_cancel);
+	};
+
+	typedef std::shared_ptr<Hierarchy const> HierarchyPtr;
+
+	struct IndexState
+	{
+		~IndexState()
+		{
+			if (cancel)
+				*cancel = true;
+			if (builder.joinable())
+				builder.join();
+		}
+
+		std::mutex										mutex;
+		std::unordered_map<Key, HierarchyPtr, KeyHasher>	indices;
+		std::thread										builder;
+		Key												building;
+		std::shared_ptr<std::atomic<bool>>				cancel;
+		std::unordered_set<Key, KeyHasher>				stale;		//models whose index was invalidated, built again when next picked
+	};
+
+	IndexState & GetIndexState()
+	{
+		static IndexState index_state;
+		return index_state;
+	}
+
+	HierarchyPtr GetHierarchy(Model const & in_model)
+	{
+		if (in_model.Type() == HPS::Type::None)
+			return HierarchyPtr();
+
+		IndexState & state = GetIndexState();
+		bool rebuild;
+		{
+			std::lock_guard<std::mutex> lock(state.mutex);
+			auto it = state.indices.find(in_model.GetSegmentKey());
+			if (it != state.indices.end())
+				return it->second;
+			rebuild = state.stale.erase(in_model.GetSegmentKey()) > 0;
+		}
+
+		//the pick which finds the index invalidated falls back to selection, later ones use the new index
+		if (rebuild)
+			PickingIndex::BuildAsync(in_model);
+		return HierarchyPtr();
+	}
+
+	HierarchyPtr BuildHierarchy(SegmentKey const & in_model_segment, std::atomic<bool> const & in_cancel)
+	{
+		try
+		{
+			std::shared_ptr<Hierarchy> hierarchy = std::make_shared<Hierarchy>();
+			KeyArray path;
+			if (!hierarchy->Collect(in_model_segment, MatrixKit::GetDefault(), path, in_cancel) ||
+				hierarchy->triangles.empty() ||
+				!hierarchy->Build(in_cancel))
+				return HierarchyPtr();
+			return hierarchy;
+		}
+		catch (HPS::InvalidObjectException const &)
+		{
+			//the model was deleted while it was being indexed
+			return HierarchyPtr();
+		}
+	}
+
+	void Project(float const * m, Point const & in_point, float & out_x, float & out_y, float & out_w)
+	{
+		out_w = in_point.x * m[3] + in_point.y * m[7] + in_point.z * m[11] + m[15];
+		out_x = in_point.x * m[0] + in_point.y * m[4] + in_point.z * m[8] + m[12];
+		out_y = in_point.x * m[1] + in_point.y * m[5] + in_point.z * m[9] + m[13];
+		if (out_w > 0)
+		{
+			out_x /= out_w;
+			out_y /= out_w;
+		}
+	}
+
+	bool IntersectBox(Node const & in_node, Point const & in_origin, Vector const & in_inverse_direction, float in_min_parameter, float in_max_parameter)
+	{
+		float const origin[3] = { in_origin.x, in_origin.y, in_origin.z };
+		float const inverse_direction[3] = { in_inverse_direction.x, in_inverse_direction.y, in_inverse_direction.z };
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			float near_parameter = (in_node.min[axis] - origin[axis]) * inverse_direction[axis];
+			float far_parameter = (in_node.max[axis] - origin[axis]) * inverse_direction[axis];
+			if (near_parameter > far_parameter)
+				std::swap(near_parameter, far_parameter);
+			in_min_parameter = (std::max)(in_min_parameter, near_parameter);
+			in_max_parameter = (std::min)(in_max_parameter, far_parameter);
+			if (in_min_parameter > in_max_parameter)
+				return false;
+		}
+		return true;
+	}
+}
+
+bool Hierarchy::Collect(SegmentKey const & in_segment, MatrixKit const & in_parent_matrix, KeyArray & io_path, std::atomic<bool> const & in_cancel)
+{
+	if (in_cancel)
+		return false;
+
+	MatrixKit matrix = in_parent_matrix;
+	MatrixKit local_matrix;
+	if (in_segment.ShowModellingMatrix(local_matrix))
+		matrix = local_matrix.Multiply(in_parent_matrix);
+
+	io_path.push_back(in_segment);
+
+	SearchResults results;
+	if (in_segment.Find(Search::Type::Shell, Search::Space::SegmentOnly, results) > 0)
+	{
+		auto it = results.GetIterator();
+		while (it.IsValid())
+		{
+			AddShell(ShellKey(it.GetItem()), matrix, io_path);
+			it.Next();
+		}
+	}
+
+	SegmentKeyArray children;
+	in_segment.ShowSubsegments(children);
+	for (auto const & child : children)
+	{
+		//interaction proxies duplicate the shells of their parent, and budget boxes stand in for unloaded ones
+		if (InteractionLOD::IsProxySegment(child) || MemoryBudget::IsProxySegment(child))
+			continue;
+		if (!Collect(child, matrix, io_path, in_cancel))
+			return false;
+	}
+
+	if (in_segment.Find(Search::Type::Include, Search::Space::SegmentOnly, results) > 0)
+	{
+		auto it = results.GetIterator();
+		while (it.IsValid())
+		{
+			IncludeKey include(it.GetItem());
+			io_path.push_back(include);
+			if (!Collect(include.GetTarget(), matrix, io_path, in_cancel))
+				return false;
+			io_path.pop_back();
+			it.Next();
+		}
+	}
+
+	io_path.pop_back();
+	return true;
+}
+
+void Hierarchy::AddShell(ShellKey const & in_shell, MatrixKit const & in_matrix, KeyArray const & in_path)
+{
+	PointArray points;
+	IntArray facelist;
+	if (!in_shell.ShowPoints(points) || !in_shell.ShowFacelist(facelist))
+		return;
+	points = in_matrix.Transform(points);
+
+	//paths are stored from the root while collecting, KeyPath expects them starting from the leaf
+	Instance instance;
+	instance.path = KeyPath(KeyArray(in_path.rbegin(), in_path.rend()));
+	instance.shell = in_shell;
+	uint32_t const instance_index = static_cast<uint32_t>(instances.size());
+	instances.push_back(instance);
+
+	uint32_t face = 0;
+	size_t i = 0;
+	while (i < facelist.size())
+	{
+		int const count = facelist[i++];
+		//holes do not change which points the face covers, skip them
+		if (count > 0)
+		{
+			for (int j = 1; j + 1 < count; ++j)
+			{
+				Triangle triangle;
+				triangle.origin = points[facelist[i]];
+				triangle.edge_one = points[facelist[i + j]] - triangle.origin;
+				triangle.edge_two = points[facelist[i + j + 1]] - triangle.origin;
+				triangle.instance = instance_index;
+				triangle.face = face;
+				triangles.push_back(triangle);
+			}
+			++face;
+		}
+		i += static_cast<size_t>(count < 0 ? -count : count);
+	}
+}
+
+bool Hierarchy::Build(std::atomic<bool> const & in_cancel)
+{
+	uint32_t const triangle_count = static_cast<uint32_t>(triangles.size());
+	std::vector<Point> centroids(triangle_count);
+	std::vector<uint32_t> order(triangle_count);
+	for (uint32_t i = 0; i < triangle_count; ++i)
+	{
+		Triangle const & triangle = triangles[i];
+		centroids[i] = triangle.origin + (triangle.edge_one + triangle.edge_two) / 3.0f;
+		order[i] = i;
+	}
+
+	nodes.reserve(2 * (triangle_count / max_leaf_triangles + 1));
+	BuildNode(0, triangle_count, order, centroids, in_cancel);
+	if (in_cancel)
+		return false;
+
+	//store the triangles in the order of the leaves, so that the triangles of a subtree are contiguous
+	std::vector<Triangle> ordered_triangles(triangle_count);
+	for (uint32_t i = 0; i < triangle_count; ++i)
+		ordered_triangles[i] = triangles[order[i]];
+	triangles.swap(ordered_triangles);
+	return true;
+}
+
+uint32_t Hierarchy::BuildNode(uint32_t in_first, uint32_t in_count, std::vector<uint32_t> & io_order, std::vector<Point> const & in_centroids, std::atomic<bool> const & in_cancel)
+{
+	uint32_t const node_index = static_cast<uint32_t>(nodes.size());
+	nodes.push_back(Node());
+
+	Node node;
+	node.first = in_first;
+	node.count = in_count;
+	node.right = 0;
+
+	float centroid_min[3];
+	float centroid_max[3];
+	for (int axis = 0; axis < 3; ++axis)
+	{
+		node.min[axis] = centroid_min[axis] = (std::numeric_limits<float>::max)();
+		node.max[axis] = centroid_max[axis] = -(std::numeric_limits<float>::max)();
+	}
+
+	for (uint32_t i = in_first; i < in_first + in_count; ++i)
+	{
+		Triangle const & triangle = triangles[io_order[i]];
+		Point const corners[3] = { triangle.origin, triangle.origin + triangle.edge_one, triangle.origin + triangle.edge_two };
+		for (auto const & corner : corners)
+		{
+			float const coordinates[3] = { corner.x, corner.y, corner.z };
+			for (int axis = 0; axis < 3; ++axis)
+			{
+				node.min[axis] = (std::min)(node.min[axis], coordinates[axis]);
+				node.max[axis] = (std::max)(node.max[axis], coordinates[axis]);
+			}
+		}
+
+		Point const & centroid = in_centroids[io_order[i]];
+		float const coordinates[3] = { centroid.x, centroid.y, centroid.z };
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			centroid_min[axis] = (std::min)(centroid_min[axis], coordinates[axis]);
+			centroid_max[axis] = (std::max)(centroid_max[axis], coordinates[axis]);
+		}
+	}
+
+	//split at the median along the longest axis of the centroids
+	int split_axis = 0;
+	for (int axis = 1; axis < 3; ++axis)
+	{
+		if (centroid_max[axis] - centroid_min[axis] > centroid_max[split_axis] - centroid_min[split_axis])
+			split_axis = axis;
+	}
+
+	if (in_count > max_leaf_triangles && centroid_max[split_axis] > centroid_min[split_axis] && !in_cancel)
+	{
+		uint32_t const middle = in_first + in_count / 2;
+		std::nth_element(io_order.begin() + in_first, io_order.begin() + middle, io_order.begin() + in_first + in_count,
+			[&in_centroids, split_axis](uint32_t in_one, uint32_t in_two)
+		{
+			Point const & one = in_centroids[in_one];
+			Point const & two = in_centroids[in_two];
+			if (split_axis == 0)
+				return one.x < two.x;
+			else if (split_axis == 1)
+				return one.y < two.y;
+			return one.z < two.z;
+		});
+
+		BuildNode(in_first, middle - in_first, io_order, in_centroids, in_cancel);
+		node.right = BuildNode(middle, in_first + in_count - middle, io_order, in_centroids, in_cancel);
+	}
+
+	nodes[node_index] = node;
+	return node_index;
+}
+
+bool Hierarchy::IntersectRay(Point const & in_origin, Vector const & in_direction, float in_min_parameter, float & out_parameter, uint32_t & out_triangle) const
+{
+	Vector const inverse_direction(1.0f / in_direction.x, 1.0f / in_direction.y, 1.0f / in_direction.z);
+	float closest_parameter = (std::numeric_limits<float>::max)();
+	bool hit = false;
+
+	uint32_t stack[64];
+	int stack_size = 0;
+	stack[stack_size++] = 0;
+	while (stack_size > 0)
+	{
+		Node const & node = nodes[stack[--stack_size]];
+		if (!IntersectBox(node, in_origin, inverse_direction, in_min_parameter, closest_parameter))
+			continue;
+
+		if (node.right != 0 && stack_size + 2 <= 64)
+		{
+			uint32_t const left = static_cast<uint32_t>(&node - nodes.data()) + 1;
+			stack[stack_size++] = node.right;
+			stack[stack_size++] = left;
+			continue;
+		}
+
+		//leaves, and subtrees too deep for the stack, are tested triangle by triangle
+		for (uint32_t i = node.first; i < node.first + node.count; ++i)
+		{
+			Triangle const & triangle = triangles[i];
+			Vector const p = in_direction.Cross(triangle.edge_two);
+			float const determinant = triangle.edge_one.Dot(p);
+			if (determinant == 0)
+				continue;
+
+			float const inverse_determinant = 1.0f / determinant;
+			Vector const s(in_origin - triangle.origin);
+			float const a = s.Dot(p) * inverse_determinant;
+			if (a < 0 || a > 1)
+				continue;
+
+			Vector const q = s.Cross(triangle.edge_one);
+			float const b = in_direction.Dot(q) * inverse_determinant;
+			if (b < 0 || a + b > 1)
+				continue;
+
+			float const parameter = triangle.edge_two.Dot(q) * inverse_determinant;
+			if (parameter >= in_min_parameter && parameter < closest_parameter)
+			{
+				closest_parameter = parameter;
+				out_triangle = i;
+				hit = true;
+			}
+		}
+	}
+
+	out_parameter = closest_parameter;
+	return hit;
+}
+
+void Hierarchy::FindInArea(float const * in_world_to_window, Rectangle const & in_area, std::vector<uint32_t> & out_triangles, std::vector<uint32_t> & out_leaves) const
+{
+	std::vector<uint32_t> stack(1, 0);
+	while (!stack.empty())
+	{
+		uint32_t const node_index = stack.back();
+		stack.pop_back();
+		Node const & node = nodes[node_index];
+
+		//project the corners of the box, boxes which cross the camera plane cannot be projected and are always opened
+		bool projectable = true;
+		float left = (std::numeric_limits<float>::max)(), right = -(std::numeric_limits<float>::max)();
+		float bottom = (std::numeric_limits<float>::max)(), top = -(std::numeric_limits<float>::max)();
+		for (int corner = 0; corner < 8 && projectable; ++corner)
+		{
+			Point const point((corner & 1) ? node.max[0] : node.min[0], (corner & 2) ? node.max[1] : node.min[1], (corner & 4) ? node.max[2] : node.min[2]);
+			float x, y, w;
+			Project(in_world_to_window, point, x, y, w);
+			if (w <= 0)
+				projectable = false;
+			left = (std::min)(left, x);
+			right = (std::max)(right, x);
+			bottom = (std::min)(bottom, y);
+			top = (std::max)(top, y);
+		}
+
+		if (projectable)
+		{
+			if (right < in_area.left || left > in_area.right || top < in_area.bottom || bottom > in_area.top)
+				continue;
+
+			if (left >= in_area.left && right <= in_area.right && bottom >= in_area.bottom && top <= in_area.top)
+			{
+				//everything in the box is in the area
+				for (uint32_t i = node.first; i < node.first + node.count; ++i)
+					out_triangles.push_back(i);
+				continue;
+			}
+		}
+
+		if (node.right == 0)
+			out_leaves.push_back(node_index);
+		else
+		{
+			stack.push_back(node.right);
+			stack.push_back(node_index + 1);
+		}
+	}
+}
+
+bool Hierarchy::TriangleInArea(uint32_t in_triangle, float const * in_world_to_window, Rectangle const & in_area) const
+{
+	Triangle const & triangle = triangles[in_triangle];
+	Point const corners[3] = { triangle.origin, triangle.origin + triangle.edge_one, triangle.origin + triangle.edge_two };
+
+	float x[3], y[3];
+	for (int i = 0; i < 3; ++i)
+	{
+		float w;
+		Project(in_world_to_window, corners[i], x[i], y[i], w);
+		if (w <= 0)
+			return false;
+		if (x[i] >= in_area.left && x[i] <= in_area.right && y[i] >= in_area.bottom && y[i] <= in_area.top)
+			return true;
+	}
+
+	if ((std::max)((std::max)(x[0], x[1]), x[2]) < in_area.left || (std::min)((std::min)(x[0], x[1]), x[2]) > in_area.right ||
+		(std::max)((std::max)(y[0], y[1]), y[2]) < in_area.bottom || (std::min)((std::min)(y[0], y[1]), y[2]) > in_area.top)
+		return false;
+
+	//the area is outside of the triangle if all of its corners are on the outer side of one of the edges
+	float const area_x[4] = { in_area.left, in_area.right, in_area.right, in_area.left };
+	float const area_y[4] = { in_area.bottom, in_area.bottom, in_area.top, in_area.top };
+	for (int i = 0; i < 3; ++i)
+	{
+		int const next = (i + 1) % 3;
+		int const opposite = (i + 2) % 3;
+		float const edge_x = x[next] - x[i];
+		float const edge_y = y[next] - y[i];
+		float const inner_side = edge_x * (y[opposite] - y[i]) - edge_y * (x[opposite] - x[i]);
+
+		bool separated = true;
+		for (int j = 0; j < 4 && separated; ++j)
+		{
+			float const side = edge_x * (area_y[j] - y[i]) - edge_y * (area_x[j] - x[i]);
+			if (side * inner_side >= 0)
+				separated = false;
+		}
+		if (separated)
+			return false;
+	}
+	return true;
+}
+
+void HPS::PickingIndex::BuildAsync(HPS::Model const & in_model)
+{
+	if (in_model.Type() == HPS::Type::None)
+		return;
+
+	SegmentKey model_segment = in_model.GetSegmentKey();
+	std::shared_ptr<std::atomic<bool>> cancel = std::make_shared<std::atomic<bool>>(false);
+
+	IndexState & state = GetIndexState();
+	std::thread previous_builder;
+	{
+		std::lock_guard<std::mutex> lock(state.mutex);
+		if (state.cancel)
+			*state.cancel = true;
+		previous_builder = std::move(state.builder);
+
+		state.indices.erase(model_segment);
+		state.stale.erase(model_segment);
+		state.building = model_segment;
+		state.cancel = cancel;
+		state.builder = std::thread([model_segment, cancel]()
+		{
+			HierarchyPtr hierarchy = BuildHierarchy(model_segment, *cancel);
+			if (!hierarchy)
+				return;
+
+			IndexState & state = GetIndexState();
+			std::lock_guard<std::mutex> lock(state.mutex);
+			if (!*cancel)
+				state.indices[model_segment] = hierarchy;
+		});
+	}
+
+	if (previous_builder.joinable())
+		previous_builder.join();
+}
+
+bool HPS::PickingIndex::Build(HPS::Model const & in_model)
+{
+	if (in_model.Type() == HPS::Type::None)
+		return false;
+
+	SegmentKey model_segment = in_model.GetSegmentKey();
+	std::atomic<bool> cancel(false);
+	HierarchyPtr hierarchy = BuildHierarchy(model_segment, cancel);
+
+	IndexState & state = GetIndexState();
+	std::lock_guard<std::mutex> lock(state.mutex);
+	state.stale.erase(model_segment);
+	if (hierarchy)
+		state.indices[model_segment] = hierarchy;
+	else
+		state.indices.erase(model_segment);
+	return !!hierarchy;
+}
+
+bool HPS::PickingIndex::IsReady(HPS::Model const & in_model)
+{
+	return !!GetHierarchy(in_model);
+}
+
+namespace
+{
+	void DiscardIndex(Model const & in_model, bool in_rebuild)
+	{
+		if (in_model.Type() == HPS::Type::None)
+			return;
+
+		SegmentKey model_segment = in_model.GetSegmentKey();
+		IndexState & state = GetIndexState();
+		std::thread builder;
+		{
+			std::lock_guard<std::mutex> lock(state.mutex);
+			bool indexed = state.indices.erase(model_segment) > 0 || state.building == model_segment || state.stale.count(model_segment) > 0;
+			if (in_rebuild && indexed)
+				state.stale.insert(model_segment);
+			else
+				state.stale.erase(model_segment);
+
+			if (state.building == model_segment && state.cancel)
+			{
+				*state.cancel = true;
+				builder = std::move(state.builder);
+				state.building = Key();
+			}
+		}
+
+		if (builder.joinable())
+			builder.join();
+	}
+}
+
+void HPS::PickingIndex::Invalidate(HPS::Model const & in_model)
+{
+	DiscardIndex(in_model, true);
+}
+
+void HPS::PickingIndex::Remove(HPS::Model const & in_model)
+{
+	DiscardIndex(in_model, false);
+}
+
+void HPS::PickingIndex::InvalidateAll()
+{
+	IndexState & state = GetIndexState();
+	std::thread builder;
+	{
+		std::lock_guard<std::mutex> lock(state.mutex);
+		for (auto const & index : state.indices)
+			state.stale.insert(index.first);
+		state.indices.clear();
+		if (state.building.Type() != HPS::Type::None && state.cancel)
+		{
+			state.stale.insert(state.building);
+			*state.cancel = true;
+			builder = std::move(state.builder);
+			state.building = Key();
+		}
+	}
+
+	if (builder.joinable())
+		builder.join();
+}
+
+void HPS::PickingIndex::Shutdown()
+{
+	IndexState & state = GetIndexState();
+	std::thread builder;
+	{
+		std::lock_guard<std::mutex> lock(state.mutex);
+		if (state.cancel)
+			*state.cancel = true;
+		builder = std::move(state.builder);
+		state.building = Key();
+		state.indices.clear();
+		state.stale.clear();
+	}
+
+	if (builder.joinable())
+		builder.join();
+}
+
+size_t HPS::PickingIndex::GetMemoryUsage()
+{
+	IndexState & state = GetIndexState();
+	std::lock_guard<std::mutex> lock(state.mutex);
+	size_t bytes = 0;
+	for (auto const & index : state.indices)
+	{
+		Hierarchy const & hierarchy = *index.second;
+		//key paths are counted by their size only, they are small compared to the triangles
+		bytes += hierarchy.instances.capacity() * sizeof(Instance);
+		bytes += hierarchy.triangles.capacity() * sizeof(Triangle);
+		bytes += hierarchy.nodes.capacity() * sizeof(Node);
+	}
+	return bytes;
+}
+
+bool HPS::PickingIndex::PickByRay(HPS::Model const & in_model, HPS::Point const & in_origin, HPS::Vector const & in_direction, Hit & out_hit)
+{
+	HierarchyPtr hierarchy = GetHierarchy(in_model);
+	if (!hierarchy)
+		return false;
+
+	float parameter;
+	uint32_t triangle_index;
+	if (!hierarchy->IntersectRay(in_origin, in_direction, 0, parameter, triangle_index))
+		return false;
+
+	Triangle const & triangle = hierarchy->triangles[triangle_index];
+	Instance const & instance = hierarchy->instances[triangle.instance];
+	out_hit.path = instance.path;
+	out_hit.shell = instance.shell;
+	out_hit.face = triangle.face;
+	out_hit.position = in_origin + in_direction * parameter;
+	out_hit.distance = parameter * static_cast<float>(in_direction.Length());
+	return true;
+}
+
+bool HPS::PickingIndex::MatchesView(HPS::View const & in_view)
+{
+	if (in_view.Type() == HPS::Type::None)
+		return false;
+
+	SearchResults results;
+	if (in_view.GetSegmentKey().Find(Search::Type::CuttingSection, Search::Space::SubsegmentsAndIncludes, results) > 0)
+		return false;
+
+	//any face visibility setting is taken as hiding something, whether it does is not worth working out
+	Model model = in_view.GetAttachedModel();
+	if (model.Type() != HPS::Type::None &&
+		model.GetSegmentKey().Find(Search::Type::VisibilityFaces, Search::Space::SubsegmentsAndIncludes, results) > 0)
+		return false;
+
+	return true;
+}
+
+bool HPS::PickingIndex::PickByPoint(HPS::Model const & in_model, HPS::KeyPath const & in_event_path, HPS::Point const & in_window_point, Hit & out_hit)
+{
+	HierarchyPtr hierarchy = GetHierarchy(in_model);
+	if (!hierarchy)
+		return false;
+
+	CameraKit camera;
+	Point camera_position;
+	Point camera_target;
+	Camera::Projection projection;
+	Point world_point;
+	if (!in_event_path.ShowNetCamera(camera) ||
+		!camera.ShowPosition(camera_position) ||
+		!camera.ShowTarget(camera_target) ||
+		!camera.ShowProjection(projection) ||
+		!in_event_path.ConvertCoordinate(Coordinate::Space::Window, in_window_point, Coordinate::Space::World, world_point))
+		return false;
+
+	//perspective rays start at the camera, orthographic ones go through the whole scene
+	Point origin;
+	Vector direction;
+	float min_parameter;
+	if (projection == Camera::Projection::Perspective)
+	{
+		origin = camera_position;
+		direction = world_point - camera_position;
+		min_parameter = 0;
+	}
+	else
+	{
+		origin = world_point;
+		direction = camera_target - camera_position;
+		min_parameter = -(std::numeric_limits<float>::max)();
+	}
+
+	float parameter;
+	uint32_t triangle_index;
+	if (!hierarchy->IntersectRay(origin, direction, min_parameter, parameter, triangle_index))
+		return false;
+
+	Triangle const & triangle = hierarchy->triangles[triangle_index];
+	Instance const & instance = hierarchy->instances[triangle.instance];
+	out_hit.path = instance.path;
+	out_hit.shell = instance.shell;
+	out_hit.face = triangle.face;
+	out_hit.position = origin + direction * parameter;
+	out_hit.distance = static_cast<float>((out_hit.position - camera_position).Length());
+	return true;
+}
+
+size_t HPS::PickingIndex::PickByArea(HPS::Model const & in_model, HPS::KeyPath const & in_event_path, HPS::Rectangle const & in_area, HitArray & out_hits, size_t in_worker_count)
+{
+	out_hits.clear();
+	HierarchyPtr hierarchy = GetHierarchy(in_model);
+	if (!hierarchy)
+		return 0;
+
+	MatrixKit world_to_window;
+	FloatArray elements;
+	if (!in_event_path.ComputeTransform(Coordinate::Space::World, Coordinate::Space::Window, world_to_window) ||
+		!world_to_window.ShowElements(elements) || elements.size() != 16)
+		return 0;
+
+	//the hierarchy is walked on this thread, the triangles of the leaves which straddle the area are tested in parallel
+	std::vector<uint32_t> inside_triangles;
+	std::vector<uint32_t> leaves;
+	hierarchy->FindInArea(elements.data(), in_area, inside_triangles, leaves);
+
+	uint32_t const no_triangle = (std::numeric_limits<uint32_t>::max)();
+	std::vector<uint32_t> instance_triangles(hierarchy->instances.size(), no_triangle);
+	for (uint32_t triangle_index : inside_triangles)
+	{
+		uint32_t & first_triangle = instance_triangles[hierarchy->triangles[triangle_index].instance];
+		first_triangle = (std::min)(first_triangle, triangle_index);
+	}
+
+	size_t const job_count = leaves.size();
+	if (job_count > 0)
+	{
+		size_t worker_count = in_worker_count;
+		if (worker_count == 0)
+			worker_count = (std::max)(static_cast<size_t>(std::thread::hardware_concurrency()), static_cast<size_t>(1));
+		worker_count = (std::min)(worker_count, job_count);
+
+		std::vector<std::vector<uint32_t>> worker_hits(worker_count);
+		std::atomic<size_t> next_job(0);
+		auto worker = [&](size_t in_worker)
+		{
+			for (size_t job = next_job++; job < job_count; job = next_job++)
+			{
+				Node const & leaf = hierarchy->nodes[leaves[job]];
+				for (uint32_t i = leaf.first; i < leaf.first + leaf.count; ++i)
+				{
+					if (hierarchy->TriangleInArea(i, elements.data(), in_area))
+						worker_hits[in_worker].push_back(i);
+				}
+			}
+		};
+
+		std::vector<std::thread> workers;
+		for (size_t i = 1; i < worker_count; ++i)
+			workers.emplace_back(worker, i);
+		worker(0);
+		for (auto & one_worker : workers)
+			one_worker.join();
+
+		for (auto const & hits : worker_hits)
+		{
+			for (uint32_t triangle_index : hits)
+			{
+				uint32_t & first_triangle = instance_triangles[hierarchy->triangles[triangle_index].instance];
+				first_triangle = (std::min)(first_triangle, triangle_index);
+			}
+		}
+	}
+
+	for (size_t i = 0; i < instance_triangles.size(); ++i)
+	{
+		if (instance_triangles[i] == no_triangle)
+			continue;
+
+		Triangle const & triangle = hierarchy->triangles[instance_triangles[i]];
+		Hit hit;
+		hit.path = hierarchy->instances[i].path;
+		hit.shell = hierarchy->instances[i].shell;
+		hit.face = triangle.face;
+		hit.position = triangle.origin + (triangle.edge_one + triangle.edge_two) / 3.0f;
+		hit.distance = 0;
+		out_hits.push_back(hit);
+	}
+	return out_hits.size();
+}
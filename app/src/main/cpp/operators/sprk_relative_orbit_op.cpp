@@ -161,8 +161,18 @@ bool HPS::RelativeOrbitOperator::OrbitCommon(HPS::WindowPoint const & in_loc, HP
 
 void HPS::RelativeOrbitOperator::CalculateTarget(KeyArray const & in_event_path)
 {
+	//once the model has been indexed the exact surface point under the cursor can be found without a visual selection,
+	//unless cutting sections or hidden segments make the index see geometry which isn't drawn
+	PickingIndex::Hit hit;
+	if (PickingIndex::MatchesView(GetAttachedView()) &&
+		PickingIndex::PickByPoint(GetAttachedView().GetAttachedModel(), KeyPath(in_event_path), start_point, hit))
+	{
+		center_of_rotation = hit.position;
+		return;
+	}
+
 	SelectionResults results;
-	size_t ret = WindowKey(in_event_path.back()).GetSelectionControl().SelectByPoint(start_point, selection_options, results);
+	size_t ret = SelectionCache::SelectByPoint(GetAttachedView(), WindowKey(in_event_path.back()), start_point, selection_options, results);
 	if (ret)
 	{
 		HPS::WorldPoint selection;
@@ -0,0 +1,575 @@
+// Copyright (c) Tech Soft 3D, Inc.
+//
+// The information contained herein is confidential and proprietary to Tech Soft 3D, Inc.,
+// and considered a trade secret as defined under civil and criminal statutes.
+// Tech Soft 3D, Inc. shall pursue its civil and criminal remedies in the event of
+// unauthorized use or misappropriation of its trade secrets.  Use of this information
+// by anyone other than authorized employees of Tech Soft 3D, Inc. is granted only under
+// a written non-disclosure agreement, expressly prescribing the scope and manner of such use.
+
+#include "sprk_ops.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
+using namespace HPS;
+
+namespace
+{
+	typedef std::unordered_set<Key, KeyHasher> KeySet;
+
+	//points must match within this fraction of the size of the shell to be instanced
+	const float match_tolerance = 1.0e-4f;
+	//shells are only compared when their radii are within a few steps of this ratio of each other
+	const double radius_step = 1.0 / 64.0;
+	//the float error of points placed far from the origin, relative to their distance to it
+	const float coordinate_error = 16 * std::numeric_limits<float>::epsilon();
+
+	struct OptimizerState
+	{
+		std::mutex							mutex;
+		std::unordered_map<Key, SegmentKey, KeyHasher>	libraries;	//root segments holding the prototypes of the instanced shells of each model
+	};
+
+	OptimizerState & GetOptimizerState()
+	{
+		static OptimizerState optimizer_state;
+		return optimizer_state;
+	}
+
+	struct IncludeUse
+	{
+		IncludeKey			include;
+		size_t				count;		//number of includes of the target in the model
+	};
+
+	struct SceneWalk
+	{
+		KeySet									segments;
+		KeySet									subsegments;	//segments reached as a subsegment of another one
+		std::unordered_map<Key, IncludeUse, KeyHasher>	includes;		//by target
+		size_t									shells;
+
+		SceneWalk() : shells(0) {}
+
+		void Visit(SegmentKey const & in_segment)
+		{
+			if (!segments.insert(in_segment).second)
+				return;
+
+			SearchResults results;
+			shells += in_segment.Find(Search::Type::Shell, Search::Space::SegmentOnly, results);
+
+			SegmentKeyArray children;
+			in_segment.ShowSubsegments(children);
+			for (auto const & child : children)
+			{
+				subsegments.insert(child);
+				Visit(child);
+			}
+
+			if (in_segment.Find(Search::Type::Include, Search::Space::SegmentOnly, results) > 0)
+			{
+				auto it = results.GetIterator();
+				while (it.IsValid())
+				{
+					IncludeKey include(it.GetItem());
+					SegmentKey target = include.GetTarget();
+					auto use = includes.find(target);
+					if (use == includes.end())
+						includes[target] = { include, 1 };
+					else
+						++use->second.count;
+					Visit(target);
+					it.Next();
+				}
+			}
+		}
+	};
+
+	//an include whose link changes how the target is drawn can't be replaced by a subsegment
+	bool IsPlainInclude(IncludeKey const & in_include)
+	{
+		int priority;
+		ConditionalExpression condition;
+		AttributeLockTypeArray filter;
+		return !in_include.ShowPriority(priority) && !in_include.ShowConditionalExpression(condition) && !in_include.ShowFilter(filter);
+	}
+
+	bool HasSubsegmentNamed(SegmentKey const & in_segment, UTF8 const & in_name)
+	{
+		SegmentKeyArray children;
+		in_segment.ShowSubsegments(children);
+		for (auto const & child : children)
+		{
+			if (child.Name() == in_name)
+				return true;
+		}
+		return false;
+	}
+
+	size_t FlattenIncludes(SceneWalk const & in_walk)
+	{
+		size_t flattened = 0;
+		for (auto const & use : in_walk.includes)
+		{
+			if (use.second.count != 1 || in_walk.subsegments.count(use.first) > 0 || !IsPlainInclude(use.second.include))
+				continue;
+
+			IncludeKey include = use.second.include;
+			SegmentKey target(use.first);
+			SegmentKey owner = include.Owner();
+
+			//subsegment names are unique, a segment of the same name would be merged with the target
+			UTF8 name = target.Name();
+			if (!name.Empty() && HasSubsegmentNamed(owner, name))
+				continue;
+
+			target.MoveTo(owner);
+			include.Delete();
+			++flattened;
+		}
+		return flattened;
+	}
+
+	//runs the jobs on the calling thread and one worker per additional core
+	template <typename Job>
+	void RunJobs(size_t in_job_count, Job const & in_job)
+	{
+		size_t worker_count = (std::max)(static_cast<size_t>(std::thread::hardware_concurrency()), static_cast<size_t>(1));
+		worker_count = (std::min)(worker_count, in_job_count);
+
+		std::atomic<size_t> next_job(0);
+		auto worker = [&]()
+		{
+			for (size_t job = next_job++; job < in_job_count; job = next_job++)
+				in_job(job);
+		};
+
+		std::vector<std::thread> workers;
+		for (size_t i = 1; i < worker_count; ++i)
+			workers.emplace_back(worker);
+		worker();
+		for (auto & one_worker : workers)
+			one_worker.join();
+	}
+
+	struct ShellData
+	{
+		ShellKey			shell;
+		SegmentKey			owner;
+		PointArray			points;
+		IntArray			facelist;
+
+		Point				centroid;
+		float				radius;		//largest distance of a point to the centroid
+		size_t				axis_point;	//the two points which fix the orientation of the shell
+		size_t				plane_point;
+		bool				oriented;
+		uint64_t			hash;			//of the connectivity, which copies share exactly
+		int64_t				radius_bucket;
+	};
+
+	//a shell whose copies could differ by more than their points is never instanced
+	bool HasLocalAttributes(ShellKey const & in_shell)
+	{
+		MaterialTypeArray types;
+		RGBColorArray rgb_colors;
+		RGBAColorArray rgba_colors;
+		FloatArray indices;
+		BoolArray validities;
+		FloatArray parameters;
+		MaterialMappingKit materials;
+		return in_shell.ShowFaceColors(types, rgb_colors, indices) ||
+			in_shell.ShowVertexColors(Shell::Component::Faces, types, rgb_colors, rgba_colors, indices) ||
+			in_shell.ShowVertexParameters(validities, parameters) ||
+			in_shell.ShowMaterialMapping(materials);
+	}
+
+	//shells already shared through includes are left as they are
+	void CollectShells(SegmentKey const & in_segment, size_t in_min_vertices, std::vector<ShellData> & out_shells)
+	{
+		SearchResults results;
+		if (in_segment.Find(Search::Type::Shell, Search::Space::SegmentOnly, results) > 0)
+		{
+			auto it = results.GetIterator();
+			while (it.IsValid())
+			{
+				ShellKey shell(it.GetItem());
+				if (shell.GetPointCount() >= in_min_vertices && !HasLocalAttributes(shell))
+				{
+					ShellData data;
+					data.shell = shell;
+					data.owner = in_segment;
+					if (shell.ShowPoints(data.points) && shell.ShowFacelist(data.facelist))
+						out_shells.push_back(std::move(data));
+				}
+				it.Next();
+			}
+		}
+
+		SegmentKeyArray children;
+		in_segment.ShowSubsegments(children);
+		for (auto const & child : children)
+			CollectShells(child, in_min_vertices, out_shells);
+	}
+
+	uint64_t HashValue(uint64_t in_hash, uint64_t in_value)
+	{
+		return (in_hash ^ in_value) * 1099511628211ull;
+	}
+
+	/* The hash only covers what copies share exactly, the point count and the facelist. The positions of copies placed far from the
+	 * origin are off by float error, which any quantization of them would turn into different hashes. The radius is only bucketed
+	 * coarsely, and shells of neighbouring buckets are compared as well. MatchShells decides. */
+	void Describe(ShellData & io_shell)
+	{
+		PointArray const & points = io_shell.points;
+		double sum[3] = { 0, 0, 0 };
+		for (auto const & point : points)
+		{
+			sum[0] += point.x;
+			sum[1] += point.y;
+			sum[2] += point.z;
+		}
+		double const count = static_cast<double>(points.size());
+		io_shell.centroid = Point(static_cast<float>(sum[0] / count), static_cast<float>(sum[1] / count), static_cast<float>(sum[2] / count));
+
+		io_shell.radius = 0;
+		io_shell.axis_point = 0;
+		for (size_t i = 0; i < points.size(); ++i)
+		{
+			float const distance = static_cast<float>((points[i] - io_shell.centroid).Length());
+			if (distance > io_shell.radius)
+			{
+				io_shell.radius = distance;
+				io_shell.axis_point = i;
+			}
+		}
+
+		io_shell.oriented = false;
+		io_shell.radius_bucket = 0;
+		if (io_shell.radius == 0)
+			return;
+		io_shell.radius_bucket = static_cast<int64_t>(std::floor(std::log(static_cast<double>(io_shell.radius)) / std::log1p(radius_step)));
+
+		Vector axis = points[io_shell.axis_point] - io_shell.centroid;
+		float farthest_from_axis = 0;
+		io_shell.plane_point = 0;
+		for (size_t i = 0; i < points.size(); ++i)
+		{
+			float distance = (points[i] - io_shell.centroid).Cross(axis).Length();
+			if (distance > farthest_from_axis)
+			{
+				farthest_from_axis = distance;
+				io_shell.plane_point = i;
+			}
+		}
+		//points all on a line have no orientation to match
+		io_shell.oriented = farthest_from_axis > match_tolerance * io_shell.radius * io_shell.radius;
+
+		uint64_t hash = HashValue(14695981039346656037ull, points.size());
+		for (int value : io_shell.facelist)
+			hash = HashValue(hash, static_cast<uint32_t>(value));
+		io_shell.hash = hash;
+	}
+
+	//orthonormal frame fixed by the centroid and two points of the shell
+	void ComputeFrame(ShellData const & in_shell, size_t in_axis_point, size_t in_plane_point, Vector out_frame[3])
+	{
+		Vector axis = in_shell.points[in_axis_point] - in_shell.centroid;
+		out_frame[0] = axis.Normalize();
+		Vector plane = in_shell.points[in_plane_point] - in_shell.centroid;
+		plane -= out_frame[0] * plane.Dot(out_frame[0]);
+		out_frame[1] = plane.Normalize();
+		out_frame[2] = out_frame[0].Cross(out_frame[1]);
+	}
+
+	/* Finds the rigid transform from the prototype to the copy. The points of copies come in the same order, so the points
+	 * which orient the prototype orient the copy as well. Elements are laid out for HPS, which transforms row vectors. */
+	bool MatchShells(ShellData const & in_prototype, ShellData const & in_copy, float out_matrix[16])
+	{
+		if (in_prototype.points.size() != in_copy.points.size() || in_prototype.facelist != in_copy.facelist)
+			return false;
+
+		Vector prototype_frame[3], copy_frame[3];
+		ComputeFrame(in_prototype, in_prototype.axis_point, in_prototype.plane_point, prototype_frame);
+		ComputeFrame(in_copy, in_prototype.axis_point, in_prototype.plane_point, copy_frame);
+
+		//rotation[i][j] is the component j of the image of the axis i
+		float rotation[3][3];
+		for (int i = 0; i < 3; ++i)
+		{
+			Vector image = copy_frame[0] * prototype_frame[0][i] + copy_frame[1] * prototype_frame[1][i] + copy_frame[2] * prototype_frame[2][i];
+			rotation[i][0] = image.x;
+			rotation[i][1] = image.y;
+			rotation[i][2] = image.z;
+		}
+
+		auto transform = [&](Point const & in_point)
+		{
+			Vector offset = in_point - in_prototype.centroid;
+			return Point(
+				in_copy.centroid.x + offset.x * rotation[0][0] + offset.y * rotation[1][0] + offset.z * rotation[2][0],
+				in_copy.centroid.y + offset.x * rotation[0][1] + offset.y * rotation[1][1] + offset.z * rotation[2][1],
+				in_copy.centroid.z + offset.x * rotation[0][2] + offset.y * rotation[1][2] + offset.z * rotation[2][2]);
+		};
+
+		//copies far from the origin carry the float error of their coordinates, whatever their size
+		float const distance_to_origin = (std::max)(static_cast<float>(Vector(in_prototype.centroid).Length()), static_cast<float>(Vector(in_copy.centroid).Length()));
+		float const tolerance = match_tolerance * in_prototype.radius + coordinate_error * (distance_to_origin + in_prototype.radius);
+		for (size_t i = 0; i < in_copy.points.size(); ++i)
+		{
+			if ((transform(in_prototype.points[i]) - in_copy.points[i]).Length() > tolerance)
+				return false;
+		}
+
+		Point origin = transform(Point(0, 0, 0));
+		for (int i = 0; i < 3; ++i)
+		{
+			for (int j = 0; j < 3; ++j)
+				out_matrix[i * 4 + j] = rotation[i][j];
+			out_matrix[i * 4 + 3] = 0;
+		}
+		out_matrix[12] = origin.x;
+		out_matrix[13] = origin.y;
+		out_matrix[14] = origin.z;
+		out_matrix[15] = 1;
+		return true;
+	}
+
+	struct Instance
+	{
+		size_t				shell;
+		float				matrix[16];
+	};
+
+	//the first shell of a cluster is its prototype
+	typedef std::vector<Instance> Cluster;
+
+	size_t InstanceShells(SegmentKey const & in_model_segment, SceneOptimizer::Options const & in_options, SegmentKey & io_library, size_t & out_prototypes)
+	{
+		out_prototypes = 0;
+
+		//the database is read on this thread, the shells are compared in parallel
+		std::vector<ShellData> shells;
+		CollectShells(in_model_segment, (std::max)(in_options.min_instance_vertices, static_cast<size_t>(3)), shells);
+		RunJobs(shells.size(), [&](size_t in_job) { Describe(shells[in_job]); });
+
+		std::unordered_map<uint64_t, std::vector<size_t>> candidates;
+		for (size_t i = 0; i < shells.size(); ++i)
+		{
+			if (shells[i].oriented)
+				candidates[shells[i].hash].push_back(i);
+		}
+
+		std::vector<std::vector<size_t> const *> groups;
+		for (auto const & candidate : candidates)
+		{
+			if (candidate.second.size() >= in_options.min_instance_count)
+				groups.push_back(&candidate.second);
+		}
+
+		std::vector<std::vector<Cluster>> group_clusters(groups.size());
+		RunJobs(groups.size(), [&](size_t in_job)
+		{
+			std::vector<Cluster> & clusters = group_clusters[in_job];
+			for (size_t shell : *groups[in_job])
+			{
+				Instance instance;
+				instance.shell = shell;
+				bool matched = false;
+				for (auto & cluster : clusters)
+				{
+					//a copy may have been bucketed next to its prototype
+					int64_t const bucket_distance = shells[cluster.front().shell].radius_bucket - shells[shell].radius_bucket;
+					if (bucket_distance >= -1 && bucket_distance <= 1 && MatchShells(shells[cluster.front().shell], shells[shell], instance.matrix))
+					{
+						cluster.push_back(instance);
+						matched = true;
+						break;
+					}
+				}
+				if (!matched)
+				{
+					MatrixKit::GetDefault().ShowElements(instance.matrix);
+					clusters.push_back(Cluster(1, instance));
+				}
+			}
+		});
+
+		//each copy gets a segment of its own, which carries its transform and includes the prototype
+		size_t instanced = 0;
+		for (auto const & clusters : group_clusters)
+		{
+			for (auto const & cluster : clusters)
+			{
+				if (cluster.size() < in_options.min_instance_count)
+					continue;
+
+				if (io_library.Type() == HPS::Type::None)
+					io_library = Database::CreateRootSegment();
+
+				ShellKit prototype_kit;
+				shells[cluster.front().shell].shell.Show(prototype_kit);
+				SegmentKey prototype = io_library.Subsegment();
+				prototype.InsertShell(prototype_kit);
+				++out_prototypes;
+
+				for (auto const & instance : cluster)
+				{
+					ShellData & shell = shells[instance.shell];
+					SegmentKey placement = shell.owner.Subsegment();
+					if (!MatrixKit(instance.matrix).Equals(MatrixKit::GetDefault()))
+						placement.SetModellingMatrix(MatrixKit(instance.matrix));
+					placement.IncludeSegment(prototype);
+					shell.shell.Delete();
+					++instanced;
+				}
+			}
+		}
+		return instanced;
+	}
+
+	void MergeSegment(SegmentKey & in_segment, SegmentOptimizationOptions::Scope in_scope)
+	{
+		SegmentOptimizationOptionsKit kit;
+		kit.SetScope(in_scope)
+			.SetReorganization(SegmentOptimizationOptions::Reorganization::Attribute)
+			.SetMatrix(SegmentOptimizationOptions::Matrix::Collapse)
+			.SetUserData(SegmentOptimizationOptions::UserData::Preserve)
+			.SetExpansion(SegmentOptimizationOptions::Expansion::None)
+			.SetShellMerging(true);
+		in_segment.Optimize(kit);
+	}
+
+	bool OwnsMappedShell(SegmentKey const & in_segment, KeySet const & in_mapped)
+	{
+		if (in_mapped.empty())
+			return false;
+
+		SearchResults results;
+		if (in_segment.Find(Search::Type::Shell, Search::Space::SegmentOnly, results) == 0)
+			return false;
+		auto it = results.GetIterator();
+		while (it.IsValid())
+		{
+			if (in_mapped.count(it.GetItem()) > 0)
+				return true;
+			it.Next();
+		}
+		return false;
+	}
+
+	/* Merges the shells of a part, and of the parts below it. Named segments and mapped segments are the parts which are picked,
+	 * highlighted and moved, so shells are only merged within a part, and the key of the part segment is kept. The shells of a
+	 * segment holding a mapped shell are left alone. Returns true if the subtree holds no part, leaving it to be merged with its parent. */
+	bool MergeParts(SegmentKey & in_segment, bool in_part, KeySet const & in_mapped)
+	{
+		SegmentKeyArray children;
+		in_segment.ShowSubsegments(children);
+
+		std::vector<bool> plain(children.size());
+		bool all_plain = true;
+		for (size_t i = 0; i < children.size(); ++i)
+		{
+			plain[i] = MergeParts(children[i], !children[i].Name().Empty() || in_mapped.count(children[i]) > 0, in_mapped);
+			all_plain = all_plain && plain[i];
+		}
+
+		bool const pinned = OwnsMappedShell(in_segment, in_mapped);
+		if (all_plain && !in_part && !pinned)
+			return true;
+		if (all_plain && !pinned)
+		{
+			MergeSegment(in_segment, SegmentOptimizationOptions::Scope::SubSegments);
+			return false;
+		}
+
+		//the plain subtrees belong to this part, but are merged apart from the segment itself to keep the parts below out of them
+		for (size_t i = 0; i < children.size(); ++i)
+		{
+			if (plain[i])
+				MergeSegment(children[i], SegmentOptimizationOptions::Scope::SubSegments);
+		}
+		if (!pinned)
+			MergeSegment(in_segment, SegmentOptimizationOptions::Scope::SegmentOnly);
+		return false;
+	}
+}
+
+bool SceneOptimizer::Optimize(Model const & in_model, Options const & in_options, Statistics & out_statistics)
+{
+	out_statistics = Statistics();
+	if (in_model.Type() == HPS::Type::None)
+		return false;
+
+	SegmentKey model_segment = in_model.GetSegmentKey();
+
+	SceneWalk before;
+	before.Visit(model_segment);
+	out_statistics.segments_before = before.segments.size();
+	out_statistics.shells_before = before.shells;
+
+	if (in_options.flatten_includes)
+		out_statistics.includes_flattened = FlattenIncludes(before);
+
+	//prototypes from an earlier optimization of the model are kept, they are still included
+	SegmentKey library;
+	{
+		OptimizerState & state = GetOptimizerState();
+		std::lock_guard<std::mutex> lock(state.mutex);
+		auto model = state.libraries.find(model_segment);
+		if (model != state.libraries.end())
+			library = model->second;
+	}
+
+	//instancing goes first, merging would fold the copies into larger shells
+	if (in_options.instance_shells)
+		out_statistics.shells_instanced = InstanceShells(model_segment, in_options, library, out_statistics.prototypes);
+
+	if (in_options.merge_shells)
+		MergeParts(model_segment, true, KeySet(in_options.mapped_keys.begin(), in_options.mapped_keys.end()));
+
+	SceneWalk after;
+	after.Visit(model_segment);
+	out_statistics.segments_after = after.segments.size();
+	out_statistics.shells_after = after.shells;
+
+	if (library.Type() != HPS::Type::None)
+	{
+		OptimizerState & state = GetOptimizerState();
+		std::lock_guard<std::mutex> lock(state.mutex);
+		state.libraries[model_segment] = library;
+	}
+	return true;
+}
+
+void SceneOptimizer::Forget(Model const & in_model)
+{
+	if (in_model.Type() == HPS::Type::None)
+		return;
+
+	OptimizerState & state = GetOptimizerState();
+	std::lock_guard<std::mutex> lock(state.mutex);
+	auto model = state.libraries.find(in_model.GetSegmentKey());
+	if (model == state.libraries.end())
+		return;
+
+	model->second.Delete();
+	state.libraries.erase(model);
+}
+
+void SceneOptimizer::Shutdown()
+{
+	OptimizerState & state = GetOptimizerState();
+	std::lock_guard<std::mutex> lock(state.mutex);
+	state.libraries.clear();
+}
@@ -9,26 +9,177 @@
 
 #include "sprk_ops.h"
 
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace
+{
+	//time spent merging batches on each timer tick, so that the UI keeps drawing
+	const std::chrono::milliseconds batch_merge_budget(8);
+
+	//number of subtrees to aim for, for each worker thread
+	const size_t subtrees_per_worker = 4;
+
+	/* Splits the model into subtrees which can be selected independently. Segments which contain geometry are kept
+	 * whole, since scoping a selection to them would also select their children. */
+	void PartitionModel(HPS::SegmentKey const & in_model_segment, HPS::KeyPath const & in_path_above_model, size_t in_target_count, std::vector<HPS::KeyPath> & out_scopes)
+	{
+		struct Subtree
+		{
+			HPS::SegmentKey		segment;
+			HPS::KeyPath		path;
+		};
+
+		std::deque<Subtree> pending;
+		Subtree model_subtree;
+		model_subtree.segment = in_model_segment;
+		model_subtree.path = in_model_segment + in_path_above_model;
+		pending.push_back(model_subtree);
+
+		while (!pending.empty() && pending.size() + out_scopes.size() < in_target_count)
+		{
+			Subtree subtree = pending.front();
+			pending.pop_front();
+
+			HPS::SearchResults results;
+			HPS::SegmentKeyArray children;
+			subtree.segment.ShowSubsegments(children);
+			size_t include_count = subtree.segment.Find(HPS::Search::Type::Include, HPS::Search::Space::SegmentOnly, results);
+			if ((children.empty() && include_count == 0) ||
+				subtree.segment.Find(HPS::Search::Type::Geometry, HPS::Search::Space::SegmentOnly, results) > 0)
+			{
+				out_scopes.push_back(subtree.path);
+				continue;
+			}
+
+			for (auto const & child : children)
+			{
+				Subtree child_subtree;
+				child_subtree.segment = child;
+				child_subtree.path = child + subtree.path;
+				pending.push_back(child_subtree);
+			}
+
+			if (include_count > 0 && subtree.segment.Find(HPS::Search::Type::Include, HPS::Search::Space::SegmentOnly, results) > 0)
+			{
+				auto it = results.GetIterator();
+				while (it.IsValid())
+				{
+					HPS::IncludeKey include(it.GetItem());
+					Subtree included_subtree;
+					included_subtree.segment = include.GetTarget();
+					included_subtree.path = included_subtree.segment + (include + subtree.path);
+					pending.push_back(included_subtree);
+					it.Next();
+				}
+			}
+		}
+
+		for (auto const & subtree : pending)
+			out_scopes.push_back(subtree.path);
+	}
+
+	/* Collects scopes for everything in the view which is not part of the model, like markups, annotations and construction
+	 * segments. The segments on the path to the model are only selected on their own, since their subtrees contain the model.
+	 * Their other subsegments and includes are selected whole. */
+	void PartitionAroundModel(HPS::KeyPath const & in_path_above_model, std::vector<HPS::KeyPath> & out_scopes, std::vector<HPS::KeyPath> & out_segment_scopes)
+	{
+		HPS::KeyArray keys;
+		in_path_above_model.ShowKeys(keys);
+
+		//the first key is the include of the model, the segments above it lead to the window
+		for (size_t i = 1; i < keys.size(); ++i)
+		{
+			if (!keys[i].HasType(HPS::Type::SegmentKey))
+				continue;
+
+			HPS::SegmentKey segment(keys[i]);
+			HPS::KeyPath path;
+			path.SetKeys(keys.size() - i, &keys[i]);
+			out_segment_scopes.push_back(path);
+
+			HPS::SegmentKeyArray children;
+			segment.ShowSubsegments(children);
+			for (auto const & child : children)
+			{
+				if (child != keys[i - 1])
+					out_scopes.push_back(child + path);
+			}
+
+			HPS::SearchResults results;
+			if (segment.Find(HPS::Search::Type::Include, HPS::Search::Space::SegmentOnly, results) > 0)
+			{
+				auto it = results.GetIterator();
+				while (it.IsValid())
+				{
+					HPS::IncludeKey include(it.GetItem());
+					if (include != keys[i - 1])
+						out_scopes.push_back(include.GetTarget() + (include + path));
+					it.Next();
+				}
+			}
+		}
+	}
+}
+
+struct HPS::SelectAreaOperator::StreamedSelection
+{
+	HPS::WindowKey						window;
+	std::mutex							mutex;
+	std::deque<HPS::SelectionResults>	batches;
+	std::atomic<bool>					cancel;
+	std::atomic<size_t>					running_workers;
+	std::vector<std::thread>			workers;
+};
+
 HPS::SelectAreaOperator::SelectAreaOperator(MouseButtons in_mouse_trigger, ModifierKeys in_modifier_trigger)
 	: ConstructRectangleOperator(in_mouse_trigger, in_modifier_trigger, true)
+	, streaming(true)
 {
 	selection_options.SetRelatedLimit(std::numeric_limits<int>::max())
 		.SetLevel(HPS::Selection::Level::Entity)
 		.SetSorting(Selection::Sorting::Off);
 }
 
+HPS::SelectAreaOperator::~SelectAreaOperator()
+{
+	CancelSelection();
+}
+
 void HPS::SelectAreaOperator::OnViewAttached(HPS::View const & in_attached_view)
 {
 	ConstructRectangleOperator::OnViewAttached(in_attached_view);
 }
 
+void HPS::SelectAreaOperator::OnViewDetached(HPS::View const & in_detached_view)
+{
+	CancelSelection();
+	ConstructRectangleOperator::OnViewDetached(in_detached_view);
+}
+
+bool HPS::SelectAreaOperator::OnMouseDown(MouseState const & in_state)
+{
+	//a new gesture supersedes the selection in progress
+	CancelSelection();
+	return ConstructRectangleOperator::OnMouseDown(in_state);
+}
+
 bool HPS::SelectAreaOperator::OnMouseUp(MouseState const  & in_state)
 {
 	if(!ConstructRectangleOperator::OnMouseUp(in_state))
 		return false;
 
 	HPS::WindowKey window = in_state.GetEventSource();
-	return SelectCommon(window, in_state.GetModifierKeys());
+	return SelectCommon(window, in_state.GetEventPath(), in_state.GetModifierKeys());
+}
+
+bool HPS::SelectAreaOperator::OnTouchDown(TouchState const & in_state)
+{
+	CancelSelection();
+	return ConstructRectangleOperator::OnTouchDown(in_state);
 }
 
 bool HPS::SelectAreaOperator::OnTouchUp(TouchState const  & in_state)
@@ -37,22 +188,68 @@ bool HPS::SelectAreaOperator::OnTouchUp(TouchState const  & in_state)
 		return false;
 
 	HPS::WindowKey window = in_state.GetEventSource();
-	return SelectCommon(window, in_state.GetModifierKeys());
+	return SelectCommon(window, in_state.GetEventPath(), in_state.GetModifierKeys());
 }
 
-bool HPS::SelectAreaOperator::SelectCommon(HPS::WindowKey & in_window, HPS::ModifierKeys in_modifiers)
+bool HPS::SelectAreaOperator::OnTimerTick(HPS::TimerTickEvent const & in_event)
+{
+	HPS_UNREFERENCED(in_event);
+	if (!streamed_selection)
+		return false;
+
+	auto const start = std::chrono::steady_clock::now();
+	bool merged = false;
+	bool finished = false;
+	while (std::chrono::steady_clock::now() - start < batch_merge_budget)
+	{
+		HPS::SelectionResults batch;
+		{
+			std::lock_guard<std::mutex> lock(streamed_selection->mutex);
+			if (streamed_selection->batches.empty())
+			{
+				//workers queue their last batch before exiting, so nothing can be left behind
+				finished = streamed_selection->running_workers == 0;
+				break;
+			}
+			batch = streamed_selection->batches.front();
+			streamed_selection->batches.pop_front();
+		}
+
+		MergeBatch(streamed_selection->window, batch);
+		merged = true;
+	}
+
+	if (finished)
+	{
+		for (auto & worker : streamed_selection->workers)
+			worker.join();
+		streamed_selection.reset();
+	}
+
+	if (merged)
+		GetAttachedView().Update();
+
+	return false;
+}
+
+bool HPS::SelectAreaOperator::SelectCommon(HPS::WindowKey & in_window, HPS::KeyArray const & in_event_path, HPS::ModifierKeys in_modifiers)
 {
 	if(IsRectangleValid())
 	{
 		try
 		{
-			HPS::SelectionResults new_selection;
-			size_t selected = in_window.GetSelectionControl().SelectByArea(GetWindowRectangle(), selection_options, new_selection);
+			OnSelectionStart(in_window, in_modifiers);
+			if (active_selection.GetCount() == 0 || !in_modifiers.Control())
+				active_selection = HPS::SelectionResults();
 
-			if(active_selection.GetCount() > 0 && in_modifiers.Control() && selected > 0)
-				active_selection.Union(new_selection);
+			if (streaming)
+				StartStreaming(in_window, in_event_path);
 			else
-				active_selection = new_selection;
+			{
+				HPS::SelectionResults new_selection;
+				if (in_window.GetSelectionControl().SelectByArea(GetWindowRectangle(), selection_options, new_selection) > 0)
+					MergeBatch(in_window, new_selection);
+			}
 		}
 		catch(HPS::InvalidObjectException const &)
 		{
@@ -68,11 +265,125 @@ bool HPS::SelectAreaOperator::SelectCommon(HPS::WindowKey & in_window, HPS::Modi
 	}
 }
 
+void HPS::SelectAreaOperator::StartStreaming(HPS::WindowKey const & in_window, HPS::KeyArray const & in_event_path)
+{
+	CancelSelection();
+
+	size_t worker_count = (std::max)(static_cast<size_t>(std::thread::hardware_concurrency()), static_cast<size_t>(1));
 
-HPS::SelectionResults HPS::SelectAreaOperator::GetActiveSelection() const
+	//only the attached model is partitioned, the rest of the view is selected around it.
+	//Selections which are already scoped, or views without a model, are done in one piece
+	std::vector<KeyPath> scopes;
+	std::vector<KeyPath> segment_scopes;
+	HPS::View view = GetAttachedView();
+	HPS::Model model = view.GetAttachedModel();
+	KeyPath existing_scope;
+	bool scope_only;
+	if (model.Type() != HPS::Type::None && !selection_options.ShowScope(existing_scope, scope_only))
+	{
+		KeyPath path_above_model = view.GetAttachedModelIncludeLink() + (view.GetModelOverrideSegmentKey() + KeyPath(in_event_path));
+		PartitionModel(model.GetSegmentKey(), path_above_model, worker_count * subtrees_per_worker, scopes);
+		PartitionAroundModel(path_above_model, scopes, segment_scopes);
+	}
+
+	std::shared_ptr<StreamedSelection> selection = std::make_shared<StreamedSelection>();
+	selection->window = in_window;
+	selection->cancel = false;
+
+	std::shared_ptr<std::vector<SelectionOptionsKit>> jobs = std::make_shared<std::vector<SelectionOptionsKit>>();
+	if (scopes.empty() && segment_scopes.empty())
+		jobs->push_back(selection_options);
+	for (auto const & scope : scopes)
+	{
+		SelectionOptionsKit options = selection_options;
+		options.SetScope(scope);
+		jobs->push_back(options);
+	}
+	for (auto const & scope : segment_scopes)
+	{
+		SelectionOptionsKit options = selection_options;
+		options.SetScope(scope, true);
+		jobs->push_back(options);
+	}
+
+	worker_count = (std::min)(worker_count, jobs->size());
+	selection->running_workers = worker_count;
+
+	std::shared_ptr<std::atomic<size_t>> next_job = std::make_shared<std::atomic<size_t>>(0);
+	Rectangle const area = GetWindowRectangle();
+	HPS::WindowKey window = in_window;
+	for (size_t i = 0; i < worker_count; ++i)
+	{
+		StreamedSelection * shared_selection = selection.get();
+		selection->workers.emplace_back([shared_selection, jobs, next_job, area, window]()
+		{
+			for (size_t job = (*next_job)++; job < jobs->size() && !shared_selection->cancel; job = (*next_job)++)
+			{
+				try
+				{
+					HPS::SelectionResults batch;
+					if (window.GetSelectionControl().SelectByArea(area, (*jobs)[job], batch) > 0)
+					{
+						std::lock_guard<std::mutex> lock(shared_selection->mutex);
+						shared_selection->batches.push_back(batch);
+					}
+				}
+				catch (HPS::InvalidObjectException const &)
+				{
+					//the window or part of the model went away, leave the rest to the other jobs
+				}
+			}
+			shared_selection->running_workers--;
+		});
+	}
+
+	streamed_selection = selection;
+}
+
+void HPS::SelectAreaOperator::MergeBatch(HPS::WindowKey const & in_window, HPS::SelectionResults const & in_batch)
 {
-	return active_selection;
+	if (active_selection.GetCount() == 0)
+	{
+		//keep a copy, the batch is handed out to OnSelectionBatch
+		active_selection = HPS::SelectionResults();
+		active_selection.Copy(in_batch);
+	}
+	else
+		active_selection.Union(in_batch);
+
+	OnSelectionBatch(in_window, in_batch);
 }
 
+void HPS::SelectAreaOperator::OnSelectionStart(HPS::WindowKey const & in_window, HPS::ModifierKeys in_modifiers)
+{
+	HPS_UNREFERENCED(in_window);
+	HPS_UNREFERENCED(in_modifiers);
+}
 
+void HPS::SelectAreaOperator::OnSelectionBatch(HPS::WindowKey const & in_window, HPS::SelectionResults const & in_batch)
+{
+	HPS_UNREFERENCED(in_window);
+	HPS_UNREFERENCED(in_batch);
+}
 
+bool HPS::SelectAreaOperator::IsSelecting() const
+{
+	return !!streamed_selection;
+}
+
+void HPS::SelectAreaOperator::CancelSelection()
+{
+	if (!streamed_selection)
+		return;
+
+	//workers finish the subtree they are working on, the batches not merged yet are dropped
+	streamed_selection->cancel = true;
+	for (auto & worker : streamed_selection->workers)
+		worker.join();
+	streamed_selection.reset();
+}
+
+HPS::SelectionResults HPS::SelectAreaOperator::GetActiveSelection() const
+{
+	return active_selection;
+}
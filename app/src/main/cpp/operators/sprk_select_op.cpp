@@ -36,7 +36,7 @@ bool HPS::SelectOperator::SelectCommon(HPS::Point const & in_loc, HPS::WindowKey
 	try
 	{
 		HPS::SelectionResults new_selection;
-		size_t selected = in_window.GetSelectionControl().SelectByPoint(in_loc, selection_options, new_selection);
+		size_t selected = SelectionCache::SelectByPoint(GetAttachedView(), in_window, in_loc, selection_options, new_selection);
 
 		if (active_selection.GetCount() > 0 && in_modifiers.Control() && selected > 0)
 		{
@@ -0,0 +1,172 @@
+// Copyright (c) Tech Soft 3D, Inc.
+//
+// The information contained herein is confidential and proprietary to Tech Soft 3D, Inc.,
+// and considered a trade secret as defined under civil and criminal statutes.
+// Tech Soft 3D, Inc. shall pursue its civil and criminal remedies in the event of
+// unauthorized use or misappropriation of its trade secrets.  Use of this information
+// by anyone other than authorized employees of Tech Soft 3D, Inc. is granted only under
+// a written non-disclosure agreement, expressly prescribing the scope and manner of such use.
+
+#include "sprk_ops.h"
+
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+
+using namespace HPS;
+
+namespace
+{
+	//window coordinates go from -1 to 1, this is well under a pixel on current displays
+	const float selection_quantum = 1.0f / 4096.0f;
+
+	//number of selections remembered for each window
+	const size_t max_cached_selections = 8;
+
+	struct CachedSelection
+	{
+		int						x;
+		int						y;
+		Key						view;
+		Key						model;
+		CameraKit				camera;
+		SelectionOptionsKit		options;
+		size_t					count;
+		SelectionResults		results;
+	};
+
+	typedef std::vector<CachedSelection> CachedSelectionArray;
+	typedef std::unordered_map<Key, CachedSelectionArray, KeyHasher> SelectionMap;
+
+	std::mutex & GetSelectionMutex()
+	{
+		static std::mutex selection_mutex;
+		return selection_mutex;
+	}
+
+	SelectionMap & GetSelectionMap()
+	{
+		static SelectionMap selection_map;
+		return selection_map;
+	}
+
+	int Quantize(float in_value)
+	{
+		return static_cast<int>(std::floor(in_value / selection_quantum + 0.5f));
+	}
+}
+
+size_t HPS::SelectionCache::SelectByPoint(HPS::View const & in_view, HPS::WindowKey const & in_window, HPS::Point const & in_location,
+										  HPS::SelectionOptionsKit const & in_options, HPS::SelectionResults & out_results)
+{
+	CachedSelection selection;
+	selection.x = Quantize(in_location.x);
+	selection.y = Quantize(in_location.y);
+	selection.view = in_view.GetSegmentKey();
+	in_view.GetSegmentKey().ShowCamera(selection.camera);
+	Model model = in_view.GetAttachedModel();
+	if (model.Type() != HPS::Type::None)
+		selection.model = model.GetSegmentKey();
+
+	{
+		std::lock_guard<std::mutex> lock(GetSelectionMutex());
+		auto it = GetSelectionMap().find(in_window);
+		if (it != GetSelectionMap().end())
+		{
+			CachedSelectionArray & cached = it->second;
+			for (size_t i = 0; i < cached.size(); ++i)
+			{
+				CachedSelection const & one_selection = cached[i];
+				if (one_selection.x == selection.x && one_selection.y == selection.y &&
+					one_selection.view == selection.view &&
+					one_selection.model == selection.model &&
+					one_selection.camera.Equals(selection.camera) &&
+					one_selection.options.Equals(in_options))
+				{
+					//hand out a copy, callers are free to combine the results with other selections
+					out_results.Copy(one_selection.results);
+					size_t count = one_selection.count;
+
+					//keep the most recently used selection at the front
+					std::rotate(cached.begin(), cached.begin() + i, cached.begin() + i + 1);
+					return count;
+				}
+			}
+		}
+	}
+
+	//the selection itself is done outside of the lock, it can take a while on large models
+	selection.options = in_options;
+	selection.count = in_window.GetSelectionControl().SelectByPoint(in_location, in_options, selection.results);
+	out_results.Copy(selection.results);
+	size_t count = selection.count;
+
+	std::lock_guard<std::mutex> lock(GetSelectionMutex());
+	SelectionMap & selection_map = GetSelectionMap();
+
+	//drop the entries of windows which have been deleted since they were cached
+	for (auto entry = selection_map.begin(); entry != selection_map.end();)
+	{
+		if (entry->first.Type() == HPS::Type::None)
+			entry = selection_map.erase(entry);
+		else
+			++entry;
+	}
+
+	CachedSelectionArray & cached = selection_map[in_window];
+	cached.insert(cached.begin(), selection);
+	if (cached.size() > max_cached_selections)
+		cached.pop_back();
+
+	return count;
+}
+
+void HPS::SelectionCache::Invalidate(HPS::WindowKey const & in_window)
+{
+	std::lock_guard<std::mutex> lock(GetSelectionMutex());
+	GetSelectionMap().erase(in_window);
+}
+
+void HPS::SelectionCache::Invalidate(HPS::Model const & in_model)
+{
+	if (in_model.Type() == HPS::Type::None)
+		return;
+
+	SegmentKey model_segment = in_model.GetSegmentKey();
+	std::lock_guard<std::mutex> lock(GetSelectionMutex());
+	for (auto & entry : GetSelectionMap())
+	{
+		CachedSelectionArray & cached = entry.second;
+		cached.erase(std::remove_if(cached.begin(), cached.end(), [&model_segment](CachedSelection const & one_selection)
+		{
+			return one_selection.model == model_segment;
+		}), cached.end());
+	}
+}
+
+void HPS::SelectionCache::Invalidate(HPS::View const & in_view)
+{
+	if (in_view.Type() == HPS::Type::None)
+		return;
+
+	SegmentKey view_segment = in_view.GetSegmentKey();
+	std::lock_guard<std::mutex> lock(GetSelectionMutex());
+	for (auto & entry : GetSelectionMap())
+	{
+		CachedSelectionArray & cached = entry.second;
+		cached.erase(std::remove_if(cached.begin(), cached.end(), [&view_segment](CachedSelection const & one_selection)
+		{
+			return one_selection.view == view_segment;
+		}), cached.end());
+	}
+}
+
+size_t HPS::SelectionCache::InvalidateAll()
+{
+	std::lock_guard<std::mutex> lock(GetSelectionMutex());
+	size_t count = 0;
+	for (auto const & window : GetSelectionMap())
+		count += window.second.size();
+	GetSelectionMap().clear();
+	return count;
+}
@@ -53,6 +53,7 @@ bool HPS::TurntableOperator::OnMouseMove(MouseState const & in_state)
 
 		start_point = in_state.GetLocation();
 
+		InteractionLOD::BeginInteraction(GetAttachedView());
 		Database::GetEventDispatcher().InjectEvent(CameraChangedEvent(GetAttachedView()));
 		GetAttachedView().Update();
 		
@@ -75,6 +76,7 @@ bool HPS::TurntableOperator::OnMouseWheel(HPS::MouseState const & in_state)
 	rotation_axis.Normalize();
 
 	TurntableCommon(mouse_wheel_sensitivity * event.WheelDelta, rotation_axis);
+	InteractionLOD::BeginInteraction(GetAttachedView());
 	Database::GetEventDispatcher().InjectEvent(CameraChangedEvent(GetAttachedView()));
 	GetAttachedView().Update();
 	return true;
@@ -147,11 +149,24 @@ bool HPS::TurntableOperator::OnTouchMove(TouchState const & in_state)
     
     start_point = touches[0].Location;
     
+	InteractionLOD::BeginInteraction(GetAttachedView());
 	Database::GetEventDispatcher().InjectEvent(CameraChangedEvent(GetAttachedView()));
     GetAttachedView().Update();
 	return true;
 }
 
+bool HPS::TurntableOperator::OnTimerTick(HPS::TimerTickEvent const &)
+{
+	if (InteractionLOD::Tick(GetAttachedView()))
+		GetAttachedView().Update();
+	return false;
+}
+
+void HPS::TurntableOperator::OnViewDetached(HPS::View const & in_detached_view)
+{
+	InteractionLOD::EndInteraction(in_detached_view);
+}
+
 void HPS::TurntableOperator::TurntableCommon(HPS::WindowPoint const & delta, HPS::Vector const & rotation_axis)
 {
 	HPS::SegmentKey view_segment = GetAttachedView().GetSegmentKey();
@@ -9,26 +9,65 @@
 
 #include "sprk_ops.h"
 
+#include <mutex>
+
 using namespace HPS;
 
+namespace
+{
+	//how many times the terrain of each model was invalidated, walk operators rebuild their index when it changes
+	struct TerrainGenerations
+	{
+		std::mutex										mutex;
+		std::unordered_map<Key, uint64_t, KeyHasher>	models;
+	};
+
+	TerrainGenerations & GetTerrainGenerations()
+	{
+		static TerrainGenerations generations;
+		return generations;
+	}
+
+	uint64_t GetTerrainGeneration(Model const & in_model)
+	{
+		TerrainGenerations & generations = GetTerrainGenerations();
+		std::lock_guard<std::mutex> lock(generations.mutex);
+		auto it = generations.models.find(in_model.GetSegmentKey());
+		return it == generations.models.end() ? 0 : it->second;
+	}
+}
+
 HPS::WalkOperator::WalkOperator(MouseButtons in_mouse_trigger, ModifierKeys in_modifier_trigger) 
-	: FlyOperator(in_mouse_trigger, in_modifier_trigger), primary_up_axis(Axis::Y)
+	: FlyOperator(in_mouse_trigger, in_modifier_trigger), primary_up_axis(Axis::Y), terrain_following(false), step_height(-1), terrain_generation(0)
 {
 
 }
 
+HPS::WalkOperator::~WalkOperator()
+{
+	CancelTerrainBuild();
+}
+
 void HPS::WalkOperator::OnViewAttached(HPS::View const & in_attached_view)
 {
 	FlyOperator::OnViewAttached(in_attached_view);
 	height_off_ground = GetKeyboardSensitivity() * 10;	//should be 10% of extents
+	InvalidateTerrain();
 	CalculateGroundPlane();
 	SnapToPlane();
 }
 
+void HPS::WalkOperator::OnViewDetached(HPS::View const & in_detached_view)
+{
+	InvalidateTerrain();
+	FlyOperator::OnViewDetached(in_detached_view);
+}
+
 void HPS::WalkOperator::OnModelAttached()
 {
 	FlyOperator::OnModelAttached();
 	height_off_ground = GetKeyboardSensitivity() * 10;	//should be 10% of extents
+	InvalidateTerrain();
 	CalculateGroundPlane();
 	SnapToPlane();
 }
@@ -42,7 +81,7 @@ void HPS::WalkOperator::CalculateGroundPlane()
 	{
 		HPS::SimpleSphere bounding_sphere;
 		HPS::SimpleCuboid bounding_cuboid;
-		model.GetSegmentKey().GetBoundingControl().ShowVolume(bounding_sphere, bounding_cuboid);
+		BoundingCache::ShowVolume(model.GetSegmentKey(), bounding_sphere, bounding_cuboid);
 
 		//create the six planes representing the bounding with extra distance applied to it
 		HPS::Plane world_bbx_planes[6];
@@ -97,6 +136,373 @@ void HPS::WalkOperator::SnapToPlane()
 	walking_direction = HPS::Vector(target - position).Normalize();
 }
 
+void HPS::WalkOperator::SetTerrainFollowing(bool in_state)
+{
+	terrain_following = in_state;
+	if (!terrain_following)
+		InvalidateTerrain();
+}
+
+void HPS::WalkOperator::InvalidateTerrain()
+{
+	CancelTerrainBuild();
+	terrain.Reset();
+}
+
+void HPS::WalkOperator::InvalidateTerrain(HPS::Model const & in_model)
+{
+	if (in_model.Type() == HPS::Type::None)
+		return;
+
+	TerrainGenerations & generations = GetTerrainGenerations();
+	std::lock_guard<std::mutex> lock(generations.mutex);
+	++generations.models[in_model.GetSegmentKey()];
+}
+
+void HPS::WalkOperator::StartTerrainBuild(HPS::SegmentKey const & in_model_segment, HPS::Vector const & in_up, uint64_t in_generation)
+{
+	InvalidateTerrain();
+
+	std::shared_ptr<TerrainBuild> build = std::make_shared<TerrainBuild>();
+	build->up = in_up;
+	build->generation = in_generation;
+	terrain_build = build;
+
+	SegmentKey model_segment = in_model_segment;
+	terrain_builder = std::thread([model_segment, build]()
+	{
+		build->index.Build(model_segment, build->up, build->cancel);
+		build->done = true;
+	});
+}
+
+void HPS::WalkOperator::CancelTerrainBuild()
+{
+	if (terrain_build)
+		terrain_build->cancel = true;
+	if (terrain_builder.joinable())
+		terrain_builder.join();
+	terrain_build.reset();
+}
+
+void HPS::WalkOperator::FollowTerrain(HPS::Point const & previous_position, HPS::Point & camera_position, HPS::Point & camera_target, bool snap_to_floor)
+{
+	HPS::Vector up(-ground.a, -ground.b, -ground.c);
+	up.Normalize();
+
+	Model model = GetAttachedView().GetAttachedModel();
+	if (model.Type() == HPS::Type::None)
+		return;
+
+	//gathering the shells takes too long for a timer tick, so the index is built in the background and the walker moves freely meanwhile
+	uint64_t const generation = GetTerrainGeneration(model);
+	if (!terrain.IsBuiltFor(up) || terrain_generation != generation)
+	{
+		bool const building = terrain_build && terrain_build->up == up && terrain_build->generation == generation;
+		if (!building)
+		{
+			StartTerrainBuild(model.GetSegmentKey(), up, generation);
+			return;
+		}
+		if (!terrain_build->done)
+			return;
+
+		terrain_builder.join();
+		terrain = std::move(terrain_build->index);
+		terrain_generation = generation;
+		terrain_build.reset();
+	}
+
+	float const step = step_height < 0 ? height_off_ground * 0.35f : step_height;
+	float const knee_offset = height_off_ground - step;
+
+	//walls are found by testing the movement at knee height, so that anything shorter than a step is walked over
+	HPS::Vector movement(camera_position - previous_position);
+	movement -= up * movement.Dot(up);
+	float const movement_length = static_cast<float>(movement.Length());
+	if (movement_length > 0)
+	{
+		float const clearance = height_off_ground * 0.25f;
+		HPS::Point const knee = previous_position + up * -knee_offset;
+		float parameter;
+		HPS::Vector wall_normal;
+		if (terrain.IntersectSegment(knee, knee + movement * ((movement_length + clearance) / movement_length), parameter, wall_normal))
+		{
+			//slide along the wall, or stop if sliding would hit something else
+			HPS::Vector slide = HPS::Vector::Zero();
+			wall_normal -= up * wall_normal.Dot(up);
+			if (wall_normal.Length() > 0)
+			{
+				wall_normal.Normalize();
+				slide = movement - wall_normal * movement.Dot(wall_normal);
+			}
+
+			float const slide_length = static_cast<float>(slide.Length());
+			if (slide_length > 0 && terrain.IntersectSegment(knee, knee + slide * ((slide_length + clearance) / slide_length), parameter, wall_normal))
+				slide = HPS::Vector::Zero();
+
+			HPS::Vector const correction = slide - movement;
+			camera_position += correction;
+			camera_target += correction;
+		}
+	}
+
+	if (snap_to_floor)
+	{
+		HPS::Point floor;
+		if (terrain.CastDown(camera_position + up * -knee_offset, step + height_off_ground * 4, floor))
+		{
+			HPS::Vector const correction = up * (HPS::Vector(floor - camera_position).Dot(up) + height_off_ground);
+			camera_position += correction;
+			camera_target += correction;
+		}
+	}
+}
+
+HPS::WalkOperator::TerrainIndex::TerrainIndex()
+	: built(false), min_u(0), min_v(0), cell_size(1), columns(0), rows(0)
+{
+}
+
+void HPS::WalkOperator::TerrainIndex::Reset()
+{
+	built = false;
+	triangles.clear();
+	cells.clear();
+	columns = 0;
+	rows = 0;
+}
+
+bool HPS::WalkOperator::TerrainIndex::IsBuiltFor(HPS::Vector const & in_up) const
+{
+	return built && up == in_up;
+}
+
+bool HPS::WalkOperator::TerrainIndex::Build(HPS::SegmentKey const & in_model_segment, HPS::Vector const & in_up, std::atomic<bool> const & in_cancel)
+{
+	Reset();
+
+	up = in_up;
+	HPS::Vector const helper = fabs(up.x) < 0.9f ? HPS::Vector(1, 0, 0) : HPS::Vector(0, 1, 0);
+	axis_u = up.Cross(helper);
+	axis_u.Normalize();
+	axis_v = up.Cross(axis_u);
+	axis_v.Normalize();
+
+	if (!Collect(in_model_segment, HPS::MatrixKit(), in_cancel))
+	{
+		Reset();
+		return false;
+	}
+	built = true;
+
+	if (triangles.empty())
+		return true;
+
+	float max_u = -(std::numeric_limits<float>::max)(), max_v = -(std::numeric_limits<float>::max)();
+	min_u = (std::numeric_limits<float>::max)();
+	min_v = (std::numeric_limits<float>::max)();
+	for (auto const & triangle : triangles)
+	{
+		HPS::Vector const corners[3] = { HPS::Vector(triangle.origin), HPS::Vector(triangle.origin) + triangle.edge_one, HPS::Vector(triangle.origin) + triangle.edge_two };
+		for (auto const & corner : corners)
+		{
+			float const u = corner.Dot(axis_u), v = corner.Dot(axis_v);
+			min_u = (std::min)(min_u, u);
+			max_u = (std::max)(max_u, u);
+			min_v = (std::min)(min_v, v);
+			max_v = (std::max)(max_v, v);
+		}
+	}
+
+	//aim for a handful of triangles per cell
+	int const resolution = HPS::Clamp(static_cast<int>(sqrt(triangles.size() / 4.0)), 1, 256);
+	cell_size = (std::max)((std::max)(max_u - min_u, max_v - min_v) / resolution, std::numeric_limits<float>::epsilon());
+	columns = static_cast<int>((max_u - min_u) / cell_size) + 1;
+	rows = static_cast<int>((max_v - min_v) / cell_size) + 1;
+	cells.resize(static_cast<size_t>(columns) * rows);
+
+	for (size_t i = 0; i < triangles.size(); ++i)
+	{
+		Triangle const & triangle = triangles[i];
+		int first_column, first_row, last_column, last_row;
+		GetCell(triangle.origin, first_column, first_row);
+		last_column = first_column;
+		last_row = first_row;
+		HPS::Point const corners[2] = { triangle.origin + triangle.edge_one, triangle.origin + triangle.edge_two };
+		for (auto const & corner : corners)
+		{
+			int column, row;
+			GetCell(corner, column, row);
+			first_column = (std::min)(first_column, column);
+			last_column = (std::max)(last_column, column);
+			first_row = (std::min)(first_row, row);
+			last_row = (std::max)(last_row, row);
+		}
+
+		for (int row = first_row; row <= last_row; ++row)
+			for (int column = first_column; column <= last_column; ++column)
+				cells[static_cast<size_t>(row) * columns + column].push_back(static_cast<uint32_t>(i));
+	}
+	return true;
+}
+
+bool HPS::WalkOperator::TerrainIndex::Collect(HPS::SegmentKey const & in_segment, HPS::MatrixKit const & in_parent_matrix, std::atomic<bool> const & in_cancel)
+{
+	if (in_cancel)
+		return false;
+
+	HPS::MatrixKit matrix = in_parent_matrix;
+	HPS::MatrixKit local_matrix;
+	if (in_segment.ShowModellingMatrix(local_matrix))
+		matrix = local_matrix.Multiply(in_parent_matrix);
+
+	HPS::SearchResults results;
+	if (in_segment.Find(Search::Type::Shell, Search::Space::SegmentOnly, results) > 0)
+	{
+		auto it = results.GetIterator();
+		while (it.IsValid())
+		{
+			AddShell(HPS::ShellKey(it.GetItem()), matrix);
+			it.Next();
+		}
+	}
+
+	HPS::SegmentKeyArray children;
+	in_segment.ShowSubsegments(children);
+	for (auto const & child : children)
+	{
+		//interaction proxies duplicate the shells of their parent, and budget boxes stand in for unloaded ones
+		if (HPS::InteractionLOD::IsProxySegment(child) || HPS::MemoryBudget::IsProxySegment(child))
+			continue;
+		if (!Collect(child, matrix, in_cancel))
+			return false;
+	}
+
+	if (in_segment.Find(Search::Type::Include, Search::Space::SegmentOnly, results) > 0)
+	{
+		auto it = results.GetIterator();
+		while (it.IsValid())
+		{
+			if (!Collect(HPS::IncludeKey(it.GetItem()).GetTarget(), matrix, in_cancel))
+				return false;
+			it.Next();
+		}
+	}
+	return true;
+}
+
+void HPS::WalkOperator::TerrainIndex::AddShell(HPS::ShellKey const & in_shell, HPS::MatrixKit const & in_matrix)
+{
+	HPS::PointArray points;
+	HPS::IntArray facelist;
+	if (!in_shell.ShowPoints(points) || !in_shell.ShowFacelist(facelist))
+		return;
+	points = in_matrix.Transform(points);
+
+	size_t i = 0;
+	while (i < facelist.size())
+	{
+		int const count = facelist[i++];
+		//holes do not change which points the face covers, skip them
+		if (count > 0)
+		{
+			for (int j = 1; j + 1 < count; ++j)
+			{
+				Triangle triangle;
+				triangle.origin = points[facelist[i]];
+				triangle.edge_one = points[facelist[i + j]] - triangle.origin;
+				triangle.edge_two = points[facelist[i + j + 1]] - triangle.origin;
+				triangle.normal = triangle.edge_one.Cross(triangle.edge_two);
+				if (triangle.normal.Length() > 0)
+				{
+					triangle.normal.Normalize();
+					triangles.push_back(triangle);
+				}
+			}
+		}
+		i += static_cast<size_t>(count < 0 ? -count : count);
+	}
+}
+
+void HPS::WalkOperator::TerrainIndex::GetCell(HPS::Point const & in_point, int & out_column, int & out_row) const
+{
+	HPS::Vector const position(in_point);
+	out_column = HPS::Clamp(static_cast<int>((position.Dot(axis_u) - min_u) / cell_size), 0, columns - 1);
+	out_row = HPS::Clamp(static_cast<int>((position.Dot(axis_v) - min_v) / cell_size), 0, rows - 1);
+}
+
+bool HPS::WalkOperator::TerrainIndex::IntersectTriangle(Triangle const & in_triangle, HPS::Point const & in_origin, HPS::Vector const & in_direction, float & out_parameter) const
+{
+	HPS::Vector const p = in_direction.Cross(in_triangle.edge_two);
+	float const determinant = in_triangle.edge_one.Dot(p);
+	if (determinant == 0)
+		return false;
+
+	float const inverse_determinant = 1.0f / determinant;
+	HPS::Vector const s(in_origin - in_triangle.origin);
+	float const a = s.Dot(p) * inverse_determinant;
+	if (a < 0 || a > 1)
+		return false;
+
+	HPS::Vector const q = s.Cross(in_triangle.edge_one);
+	float const b = in_direction.Dot(q) * inverse_determinant;
+	if (b < 0 || a + b > 1)
+		return false;
+
+	out_parameter = in_triangle.edge_two.Dot(q) * inverse_determinant;
+	return out_parameter >= 0 && out_parameter <= 1;
+}
+
+bool HPS::WalkOperator::TerrainIndex::IntersectSegment(HPS::Point const & in_start, HPS::Point const & in_end, float & out_parameter, HPS::Vector & out_normal) const
+{
+	if (cells.empty())
+		return false;
+
+	int first_column, first_row, last_column, last_row;
+	GetCell(in_start, first_column, first_row);
+	GetCell(in_end, last_column, last_row);
+	if (first_column > last_column)
+		std::swap(first_column, last_column);
+	if (first_row > last_row)
+		std::swap(first_row, last_row);
+
+	HPS::Vector const direction(in_end - in_start);
+	bool hit = false;
+	out_parameter = 2;
+	for (int row = first_row; row <= last_row; ++row)
+	{
+		for (int column = first_column; column <= last_column; ++column)
+		{
+			for (auto const index : cells[static_cast<size_t>(row) * columns + column])
+			{
+				float parameter;
+				if (IntersectTriangle(triangles[index], in_start, direction, parameter) && parameter < out_parameter)
+				{
+					out_parameter = parameter;
+					out_normal = triangles[index].normal;
+					hit = true;
+				}
+			}
+		}
+	}
+
+	return hit;
+}
+
+bool HPS::WalkOperator::TerrainIndex::CastDown(HPS::Point const & in_origin, float in_max_distance, HPS::Point & out_hit) const
+{
+	//the ray is parallel to the up vector, so it only ever visits the cell under its origin
+	float parameter;
+	HPS::Vector normal;
+	HPS::Vector const ray = up * -in_max_distance;
+	if (!IntersectSegment(in_origin, in_origin + ray, parameter, normal))
+		return false;
+
+	out_hit = in_origin + ray * parameter;
+	return true;
+}
+
 HPS::WalkOperator::Axis HPS::WalkOperator::UpdatePrimaryUpAxis(HPS::Vector const & v)
 {
 	primary_up_axis = GetPrimaryAxis(v);
@@ -149,6 +555,7 @@ bool HPS::WalkOperator::OnTimerTick(HPS::TimerTickEvent const & in_event)
 	camera.ShowPosition(camera_position);
 	camera.ShowTarget(camera_target);
 	camera.ShowUpVector(camera_up);
+	HPS::Point const previous_position = camera_position;
 
 	if (movement_flags & MovementFlags::rotating)
 	{
@@ -202,6 +609,13 @@ bool HPS::WalkOperator::OnTimerTick(HPS::TimerTickEvent const & in_event)
 			movement_flags &= ~MovementFlags::move_with_touch;
 	}
     
+	if (terrain_following && movement_flags)
+	{
+		//let the user leave the current floor while moving vertically, and snap to the floor below once they stop
+		bool const moving_vertically = (movement_flags & (MovementFlags::moving_up | MovementFlags::moving_down)) != 0;
+		FollowTerrain(previous_position, camera_position, camera_target, !moving_vertically);
+	}
+
 	HPS::Vector ground_normal(ground.a, ground.b, ground.c);
 	ground_normal.Normalize();
 
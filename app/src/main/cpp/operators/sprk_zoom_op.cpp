@@ -164,9 +164,7 @@ void HPS::ZoomOperator::UpdateZoomLimit()
 {
 	HPS::SimpleSphere sphere;
 	HPS::SimpleCuboid bounds;
-	HPS::BoundingKit bkit;
-	GetAttachedView().GetAttachedModel().GetSegmentKey().ShowBounding(bkit);
-	bkit.ShowVolume(sphere,bounds);
+	BoundingCache::ShowVolume(GetAttachedView().GetAttachedModel().GetSegmentKey(), sphere, bounds);
 
 	HPS::Vector delta = bounds.max - bounds.min;
 	zoom_limit = static_cast<float>(delta.Length()) * 0.002f;
@@ -60,6 +60,9 @@ public class AndroidMobileSurfaceView extends SurfaceView implements SurfaceHold
 	public interface Callback {
 		// Called with return value of MobileSurface::bind() 
 		public void onSurfaceBind(boolean bindRet); 
+
+		// Called on the UI thread once an image requested with exportImage() has been written, or has failed to
+		public void onImageExported(boolean success, String fileName);
 	}
 
 	// Constructor should only be called by derived class
@@ -95,6 +98,17 @@ public class AndroidMobileSurfaceView extends SurfaceView implements SurfaceHold
 	public void clearTouches() {
 		touchesCancel(mSurfacePointer);
 	}
+
+	// Called from the native capture thread
+	public void ImageExported(final boolean success, final String fileName) {
+		post(new Runnable() {
+			@Override
+			public void run() {
+				if (mSurfaceViewCallback != null)
+					mSurfaceViewCallback.onImageExported(success, fileName);
+			}
+		});
+	}
 	
 	@Override
 	public void surfaceCreated(SurfaceHolder holder) {
@@ -6,6 +6,13 @@ import android.content.Context;
 
 public class AndroidUserMobileSurfaceView extends AndroidMobileSurfaceView {
 	private static native boolean loadFileS(long ptr, String fileName);
+	private static native int getImportStatsSBI(long ptr, StringBuffer json, int capacity);
+	private static native boolean saveSessionS(long ptr, String sessionDir);
+	private static native boolean restoreSessionS(long ptr, String sessionDir);
+	private static native boolean exportImageSII(long ptr, String fileName, int width, int height);
+	private static native boolean startTraceS(long ptr, String fileName);
+	private static native boolean stopTraceV(long ptr);
+	private static native boolean playTraceSZ(long ptr, String fileName, boolean realTime);
 	private static native void setOperatorOrbitV(long ptr);
 	private static native void onModeSimpleShadowZ(long ptr, boolean enable);
 	private static native void onModeSmoothV(long ptr);
@@ -28,6 +35,41 @@ public class AndroidUserMobileSurfaceView extends AndroidMobileSurfaceView {
 	}
 
 
+	public  int getImportStats(StringBuffer json, int capacity) {
+		return  getImportStatsSBI(mSurfacePointer, json, capacity);
+	}
+
+
+	public  boolean saveSession(String sessionDir) {
+		return  saveSessionS(mSurfacePointer, sessionDir);
+	}
+
+
+	public  boolean restoreSession(String sessionDir) {
+		return  restoreSessionS(mSurfacePointer, sessionDir);
+	}
+
+
+	public  boolean exportImage(String fileName, int width, int height) {
+		return  exportImageSII(mSurfacePointer, fileName, width, height);
+	}
+
+
+	public  boolean startTrace(String fileName) {
+		return  startTraceS(mSurfacePointer, fileName);
+	}
+
+
+	public  boolean stopTrace() {
+		return  stopTraceV(mSurfacePointer);
+	}
+
+
+	public  boolean playTrace(String fileName, boolean realTime) {
+		return  playTraceSZ(mSurfacePointer, fileName, realTime);
+	}
+
+
 	public  void setOperatorOrbit() {
 		 setOperatorOrbitV(mSurfacePointer);
 	}
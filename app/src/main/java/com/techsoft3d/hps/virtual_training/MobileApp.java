@@ -7,6 +7,8 @@ public class MobileApp {
 	private static native void setLibraryDirectoryS(String libraryDir);
 	private static native void setFontDirectoryS(String fontDir);
 	private static native void setMaterialsDirectoryS(String materialsDir);
+	private static native void setCacheDirectoryS(String cacheDir);
+	private static native void trimMemoryI(int level);
 
 	public static void shutdown() {
 		 shutdownV();
@@ -28,5 +30,15 @@ public class MobileApp {
 	}
 
 
+	public static void setCacheDirectory(String cacheDir) {
+		 setCacheDirectoryS(cacheDir);
+	}
+
+
+	public static void trimMemory(int level) {
+		 trimMemoryI(level);
+	}
+
+
 }
 
@@ -41,6 +41,9 @@ public class MobileSurfaceActivity extends Activity implements
     private String mPath = Environment.getExternalStorageDirectory().getPath() + "/" + "conrod.hsf";
 
     private boolean mShouldLoadFile = true;
+
+    /* Set when the process was killed since the state was saved. The scene is then restored from the session snapshot. */
+    private boolean mShouldRestoreSession = false;
     private ProgressDialog mProgress;
 
     // Layout for activity - will hold HOOPS Visualize SurfaceView
@@ -52,6 +55,13 @@ public class MobileSurfaceActivity extends Activity implements
     // String used to store Surface pointer when activity needs to save state
     static final String MOBILE_SURFACE_POINTER_KEY = "mobileSurfaceId";
 
+    // Directory of the session snapshot, below the app cache directory
+    static final String SESSION_DIRECTORY = "session";
+
+    private File getSessionDirectory() {
+        return new File(getCacheDir(), SESSION_DIRECTORY);
+    }
+
     /**
      * Copy the given file from "Assets" to the Virtual Devices /etc/storage/0
      */
@@ -92,10 +102,14 @@ public class MobileSurfaceActivity extends Activity implements
         long mobileSurfacePointer = 0;
 
         /* If reloading saved state - don't reload the file. */
-        if (savedInstanceState != null) {
+        if (savedInstanceState != null && mNativeLibsLoaded) {
             /*  - Set the surface pointer located in the Bundle instance state */
             mobileSurfacePointer = savedInstanceState.getLong(MOBILE_SURFACE_POINTER_KEY);
             mShouldLoadFile = false;
+        } else if (savedInstanceState != null) {
+            /* The process was killed, the saved pointer is meaningless. Restore from the session snapshot instead. */
+            mShouldRestoreSession = true;
+            mProgress = ProgressDialog.show(MobileSurfaceActivity.this, "", "Restoring. Please wait...", true);
         } else {
             /* Otherwise start the progress dialog and Load File.. */
             mProgress = ProgressDialog.show(MobileSurfaceActivity.this, "", "Loading. Please wait...", true);
@@ -121,6 +135,7 @@ public class MobileSurfaceActivity extends Activity implements
         }
 
         MobileApp.setLibraryDirectory(this.getApplicationInfo().nativeLibraryDir);
+        MobileApp.setCacheDirectory(this.getCacheDir().getPath());
 
         /* Create Surface View dedicated to HOOPS Viz: https://developer.android.com/reference/android/view/SurfaceView */
         mSurfaceView = new AndroidUserMobileSurfaceView(this, this, MOBILE_SURFACE_GUI_ID, mobileSurfacePointer);
@@ -154,7 +169,7 @@ public class MobileSurfaceActivity extends Activity implements
                 showToast("User code 3!");
                 break;
             case R.id.userCode4Button:
-                showToast("User code 4!");
+                exportScreenshot();
                 break;
         }
     }
@@ -169,6 +184,13 @@ public class MobileSurfaceActivity extends Activity implements
 
         // Save our mobile surface pointer so that we can restore the Visualize Scene on reload.
         savedInstanceState.putLong(MOBILE_SURFACE_POINTER_KEY, mSurfaceView.getSurfacePointer());
+
+        // The process survives rotations, so only snapshot the scene when it may be killed in the background.
+        if (!isChangingConfigurations()) {
+            File sessionDirectory = getSessionDirectory();
+            sessionDirectory.mkdirs();
+            mSurfaceView.saveSession(sessionDirectory.getPath());
+        }
     }
 
     /**
@@ -192,12 +214,39 @@ public class MobileSurfaceActivity extends Activity implements
 
     }
 
+    /**
+     * Write the current view at twice the screen resolution. The image is rendered and encoded
+     * off screen in the background, onImageExported() is called once the file has been written.
+     */
+    private void exportScreenshot() {
+        File picturesDirectory = getExternalFilesDir(Environment.DIRECTORY_PICTURES);
+        if (picturesDirectory == null)
+            picturesDirectory = getCacheDir();
+        picturesDirectory.mkdirs();
+
+        File imageFile = new File(picturesDirectory, "screenshot_" + System.currentTimeMillis() + ".png");
+        if (mSurfaceView.exportImage(imageFile.getPath(), 2 * mSurfaceView.getWidth(), 2 * mSurfaceView.getHeight()))
+            showToast("Exporting screenshot.");
+        else
+            showToast("A screenshot is already being exported");
+    }
+
+    @Override
+    public void onImageExported(boolean success, String fileName) {
+        if (success)
+            showToast("Screenshot saved to " + fileName);
+        else
+            showToast("Screenshot failed to export");
+    }
+
     // AsyncTask for performing file load on a separate thread.
     // Note that calling cancel() on this task will *not* abort the file load.
     private class LoadFileAsyncTask extends AsyncTask<String, Void[], Boolean> {
         @Override
         protected Boolean doInBackground(String... paths) {
             // Perform file load on separate thread
+            if (mShouldRestoreSession && mSurfaceView.restoreSession(getSessionDirectory().getPath()))
+                return true;
             return mSurfaceView.loadFile(paths[0]);
         }
 
@@ -224,6 +273,14 @@ public class MobileSurfaceActivity extends Activity implements
         mSurfaceView.clearTouches();
     }
 
+    @Override
+    public void onTrimMemory(int level) {
+        super.onTrimMemory(level);
+        /* Release native caches before the OS has to kill the process to reclaim memory. */
+        if (mNativeLibsLoaded)
+            MobileApp.trimMemory(level);
+    }
+
     private void showToast(String msg) {
         Toast.makeText(getApplicationContext(), msg, Toast.LENGTH_LONG).show();
     }